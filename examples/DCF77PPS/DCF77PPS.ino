@@ -0,0 +1,100 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/**
+ * Output a second pulse and a minute pulse disciplined by the dcf77
+ * signal. On AVR, pps.service() is called every 100us from the Timer1
+ * compare match interrupt, which gives a low jitter output. Timer1 is
+ * then not available for other purposes like the Servo library or
+ * analogWrite() on pins 9 and 10. On other architectures, pps.service()
+ * is called from loop(), so the jitter depends on the duration of
+ * loop().
+ */
+
+#include "DCF77RX.h"
+
+static constexpr int DCF77_PIN = 2;
+static constexpr int PPS_PIN = 5;
+static constexpr int MINUTE_PIN = 6;
+
+DCF77RX<DCF77_PIN> myReceiver;
+DCF77PPS pps(PPS_PIN, MINUTE_PIN);
+
+static uint32_t lastSystick = 0;
+
+#ifdef ARDUINO_ARCH_AVR
+static constexpr uint32_t SERVICE_PERIOD_MICROS = 100;
+
+static void startServiceTimer() {
+  noInterrupts();
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12) | _BV(CS11); // CTC mode, prescaler 8
+  TCNT1 = 0;
+  OCR1A = F_CPU / 8 / 1000000UL * SERVICE_PERIOD_MICROS - 1;
+  TIMSK1 = _BV(OCIE1A);
+  interrupts();
+}
+
+ISR(TIMER1_COMPA_vect) {
+  pps.service(micros());
+}
+#endif
+
+//The setup function is called once at startup of the sketch
+void setup()
+{
+  Serial.begin(9600);
+  Serial.println();
+  Serial.println("------------ DCF77PPS -----------");
+  myReceiver.begin();
+  pps.begin();
+#ifdef ARDUINO_ARCH_AVR
+  startServiceTimer();
+#endif
+}
+
+// The loop function is called in an endless loop
+void loop()
+{
+  DCF77Base::DCF77event event;
+  while(myReceiver.poll(event)) {
+    if(event.mType == DCF77Base::DCF77event::MINUTE_FRAME) {
+      pps.onMinuteFrame(event.mFrame);
+    } else if(event.mType == DCF77Base::DCF77event::SECOND_TICK) {
+      pps.onSecondTick(event.mSystick, event.mSecond);
+    }
+  }
+
+#ifndef ARDUINO_ARCH_AVR
+  pps.service(micros());
+#endif
+
+  const uint32_t systick = millis();
+  if(systick - lastSystick >= 10000) {
+    Serial.print("Length of a second: ");
+    Serial.print(pps.secondLengthMicros());
+    Serial.println("us");
+    lastSystick = systick;
+  }
+}
@@ -0,0 +1,79 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/**
+ * Poll events from the dcf77 receiver within loop() and print them on
+ * Serial. No code of this sketch runs within the interrupt context.
+ */
+
+#include "DCF77RX.h"
+
+static constexpr int DCF77_PIN = 2;
+
+DCF77RX<DCF77_PIN> myReceiver;
+
+//The setup function is called once at startup of the sketch
+void setup()
+{
+  Serial.begin(9600);
+  Serial.println();
+  Serial.println("-------- PollDCF77Events --------");
+  Serial.println("First frame may take some minutes");
+  myReceiver.begin();
+}
+
+// The loop function is called in an endless loop
+void loop()
+{
+  DCF77Base::DCF77event event;
+  while(myReceiver.poll(event)) {
+    Serial.print('[');
+    Serial.print(event.mSystick);
+    Serial.print("ms] ");
+    switch(event.mType) {
+      case DCF77Base::DCF77event::SECOND_TICK:
+        Serial.print("Second ");
+        if(event.mSecond == DCF77Base::DCF77event::SECOND_UNKNOWN) {
+          Serial.println('?');
+        } else {
+          Serial.println(event.mSecond);
+        }
+        break;
+      case DCF77Base::DCF77event::MINUTE_FRAME: {
+        DCF77tm time;
+        DCF77Base::dcf77frame2time(time, event.mFrame);
+        Serial.print("DCF77 frame received: ");
+        Serial.println(time);
+        break;
+      }
+      case DCF77Base::DCF77event::PARITY_FAILURE:
+        Serial.println("DCF77 frame with parity error.");
+        break;
+      case DCF77Base::DCF77event::SIGNAL_LOST:
+        Serial.print("No DCF77 signal on Arduino pin ");
+        Serial.println(DCF77_PIN);
+        break;
+    }
+  }
+}
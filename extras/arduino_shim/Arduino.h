@@ -0,0 +1,72 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_EXTRAS_ARDUINO_SHIM_ARDUINO_H_
+#define DCF77_EXTRAS_ARDUINO_SHIM_ARDUINO_H_
+
+/**
+ * Minimal replacement of the Arduino API, that allows to compile the
+ * library for the host. Used by the host tools in extras only.
+ *
+ * The time and the pin levels are set by the host program per thread,
+ * so that independent decoder instances can run in parallel threads.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Print.h"
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 1
+#define LOW 0
+#define HIGH 1
+
+uint32_t millis();
+uint32_t micros();
+int digitalRead(int pin);
+void digitalWrite(int pin, int level);
+void pinMode(int pin, int mode);
+int digitalPinToInterrupt(int pin);
+void attachInterrupt(int interrupt, void (*handler)(), int mode);
+void noInterrupts();
+void interrupts();
+
+namespace arduino_shim {
+
+/** Set the time returned by millis() and micros() of this thread. */
+void setMicros(uint64_t micros);
+
+/** Set the level returned by digitalRead() of this thread. */
+void setPinLevel(int level);
+
+/** Install a handler that is called upon digitalWrite() of this thread. */
+void setDigitalWriteHandler(void (*handler)(int pin, int level));
+
+} // namespace arduino_shim
+
+#endif /* DCF77_EXTRAS_ARDUINO_SHIM_ARDUINO_H_ */
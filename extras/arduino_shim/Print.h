@@ -0,0 +1,54 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_EXTRAS_ARDUINO_SHIM_PRINT_H_
+#define DCF77_EXTRAS_ARDUINO_SHIM_PRINT_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+class Printable;
+
+/**
+ * Print to stdout.
+ */
+class Print {
+public:
+  size_t print(const char* s) {return printf("%s", s);}
+  size_t print(char c) {return printf("%c", c);}
+  size_t print(int v) {return printf("%d", v);}
+  size_t print(long v) {return printf("%ld", v);}
+  size_t print(unsigned long v) {return printf("%lu", v);}
+  size_t print(const Printable& p);
+};
+
+#include "Printable.h"
+
+inline size_t Print::print(const Printable& p) {
+  return p.printTo(*this);
+}
+
+#endif /* DCF77_EXTRAS_ARDUINO_SHIM_PRINT_H_ */
@@ -0,0 +1,83 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "Arduino.h"
+
+namespace {
+
+thread_local uint64_t currentMicros = 0;
+thread_local int pinLevel = HIGH;
+thread_local void (*digitalWriteHandler)(int pin, int level) = nullptr;
+
+} // anonymous namespace
+
+uint32_t millis() {
+  return currentMicros / 1000;
+}
+
+uint32_t micros() {
+  return currentMicros;
+}
+
+int digitalRead(int /*pin*/) {
+  return pinLevel;
+}
+
+void digitalWrite(int pin, int level) {
+  if(digitalWriteHandler != nullptr) {
+    digitalWriteHandler(pin, level);
+  }
+}
+
+void pinMode(int /*pin*/, int /*mode*/) {
+}
+
+int digitalPinToInterrupt(int pin) {
+  return pin;
+}
+
+void attachInterrupt(int /*interrupt*/, void (* /*handler*/)(), int /*mode*/) {
+}
+
+void noInterrupts() {
+}
+
+void interrupts() {
+}
+
+namespace arduino_shim {
+
+void setMicros(uint64_t micros) {
+  currentMicros = micros;
+}
+
+void setPinLevel(int level) {
+  pinLevel = level;
+}
+
+void setDigitalWriteHandler(void (*handler)(int pin, int level)) {
+  digitalWriteHandler = handler;
+}
+
+} // namespace arduino_shim
@@ -0,0 +1,212 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "Capture.h"
+#include "DCF77FrameEncoder.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <random>
+
+namespace {
+
+/* Start of the first generated capture: Monday 6 Jan 2025 0:00:00 UTC */
+constexpr time_t GENERATE_EPOCH = 1736121600;
+/* The captures start in the middle of a minute. */
+constexpr unsigned GENERATE_START_SECOND = 30;
+/* The recording starts shortly before the first pulse. */
+constexpr uint32_t CAPTURE_LEAD_MILLIS = 500;
+constexpr unsigned MAX_EDGE_JITTER_MILLIS = 40;
+
+struct SiteQuality {
+  unsigned mEdgeJitterMillis;
+  /* Probability of a spurious pulse per second. */
+  double mGlitchRate;
+  /* Probability of a dropout per second. */
+  double mDropoutRate;
+};
+
+SiteQuality siteQuality(const unsigned site) {
+  const unsigned degradation = site - 1;
+  SiteQuality quality;
+  quality.mEdgeJitterMillis = degradation * 4 < MAX_EDGE_JITTER_MILLIS
+      ? degradation * 4 : MAX_EDGE_JITTER_MILLIS;
+  quality.mGlitchRate = degradation * 0.002;
+  quality.mDropoutRate = degradation * 0.0005;
+  return quality;
+}
+
+void writePulse(FILE* file, const uint32_t millis, const unsigned level) {
+  fprintf(file, "%lu %u\n", static_cast<unsigned long>(millis), level);
+}
+
+void generateCapture(FILE* file, const SiteQuality& quality,
+    const unsigned minutes, const time_t startUtc, std::mt19937& rng) {
+  std::uniform_int_distribution<int> jitter(
+      -static_cast<int>(quality.mEdgeJitterMillis), quality.mEdgeJitterMillis);
+  std::uniform_real_distribution<double> chance(0.0, 1.0);
+  std::uniform_int_distribution<unsigned> glitchOffset(300, 800);
+  std::uniform_int_distribution<unsigned> glitchWidth(10, 60);
+  std::uniform_int_distribution<unsigned> dropoutSeconds(3, 30);
+
+  const uint32_t startMillis = rng();
+  fprintf(file, "# DCF77 capture: <millis> <level>\n");
+  writePulse(file, startMillis, 1);
+
+  unsigned dropout = 0;
+  for(unsigned second = GENERATE_START_SECOND; second < minutes * 60; second++) {
+    if(dropout > 0) {
+      dropout--;
+      continue;
+    }
+    if(chance(rng) < quality.mDropoutRate) {
+      dropout = dropoutSeconds(rng);
+      continue;
+    }
+
+    const unsigned secondOfMinute = second % 60;
+    if(secondOfMinute == 59) {
+      continue; // Minute mark: No pulse.
+    }
+    const time_t minuteStart = startUtc + second - secondOfMinute;
+    const uint64_t frame = encodeDCF77Frame(minuteStart + 60);
+    const unsigned bit = (frame >> secondOfMinute) & 1;
+
+    const uint32_t secondStart = startMillis + CAPTURE_LEAD_MILLIS
+        + 1000 * (second - GENERATE_START_SECOND);
+    writePulse(file, secondStart + jitter(rng), 0);
+    writePulse(file, secondStart + (bit ? 200 : 100) + jitter(rng), 1);
+    if(chance(rng) < quality.mGlitchRate) {
+      const uint32_t glitchStart = secondStart + glitchOffset(rng);
+      writePulse(file, glitchStart, 0);
+      writePulse(file, glitchStart + glitchWidth(rng), 1);
+    }
+  }
+}
+
+bool makeDirectory(const std::string& directory, std::string& error) {
+  if(mkdir(directory.c_str(), 0777) != 0 && errno != EEXIST) {
+    error = directory + ": " + strerror(errno);
+    return false;
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+CaptureReader::~CaptureReader() {
+  if(mFile != nullptr) {
+    fclose(mFile);
+  }
+}
+
+bool CaptureReader::open(const std::string& path, std::string& error) {
+  mPath = path;
+  mLineNumber = 0;
+  mFile = fopen(path.c_str(), "r");
+  if(mFile == nullptr) {
+    error = path + ": " + strerror(errno);
+    return false;
+  }
+  return true;
+}
+
+bool CaptureReader::next(CapturePulse& pulse, std::string& error) {
+  char line[128];
+  while(fgets(line, sizeof(line), mFile) != nullptr) {
+    mLineNumber++;
+    const char* p = line;
+    while(*p == ' ' || *p == '\t') {
+      p++;
+    }
+    if(*p == '#' || *p == '\n' || *p == '\r' || *p == '\0') {
+      continue;
+    }
+    char* end;
+    const unsigned long millis = strtoul(p, &end, 10);
+    const bool hasMillis = end != p;
+    p = end;
+    const unsigned long level = strtoul(p, &end, 10);
+    const bool hasLevel = end != p;
+    while(*end == ' ' || *end == '\t' || *end == '\r' || *end == '\n') {
+      end++;
+    }
+    if(not hasMillis || not hasLevel || level > 1 || *end != '\0') {
+      error = mPath + ":" + std::to_string(mLineNumber) + ": expected '<millis> <level>'";
+      return false;
+    }
+    pulse.mMillis = static_cast<uint32_t>(millis);
+    pulse.mLevel = static_cast<uint8_t>(level);
+    return true;
+  }
+  if(ferror(mFile)) {
+    error = mPath + ": read error";
+  }
+  return false;
+}
+
+std::string CaptureReader::siteOf(const std::string& path) {
+  const size_t fileStart = path.find_last_of('/');
+  if(fileStart == std::string::npos || fileStart == 0) {
+    return ".";
+  }
+  const size_t directoryStart = path.find_last_of('/', fileStart - 1);
+  return directoryStart == std::string::npos
+      ? path.substr(0, fileStart)
+      : path.substr(directoryStart + 1, fileStart - directoryStart - 1);
+}
+
+bool generateCaptures(const std::string& directory, const unsigned sites,
+    const unsigned capturesPerSite, const unsigned minutesPerCapture, std::string& error) {
+  if(not makeDirectory(directory, error)) {
+    return false;
+  }
+  for(unsigned site = 1; site <= sites; site++) {
+    const std::string siteDirectory = directory + "/site" + std::to_string(site);
+    if(not makeDirectory(siteDirectory, error)) {
+      return false;
+    }
+    for(unsigned capture = 1; capture <= capturesPerSite; capture++) {
+      const std::string path = siteDirectory + "/capture" + std::to_string(capture) + ".txt";
+      FILE* file = fopen(path.c_str(), "w");
+      if(file == nullptr) {
+        error = path + ": " + strerror(errno);
+        return false;
+      }
+      std::mt19937 rng(site * 1000 + capture);
+      const time_t startUtc = GENERATE_EPOCH
+          + static_cast<time_t>(capture - 1) * minutesPerCapture * 60;
+      generateCapture(file, siteQuality(site), minutesPerCapture, startUtc, rng);
+      const bool failed = ferror(file) != 0;
+      if(fclose(file) != 0 || failed) {
+        error = path + ": write error";
+        return false;
+      }
+    }
+  }
+  return true;
+}
@@ -0,0 +1,115 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_EXTRAS_CAPTURE_DECODER_CAPTURE_H_
+#define DCF77_EXTRAS_CAPTURE_DECODER_CAPTURE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+/**
+ * A level change of the receiver signal, as recorded from the
+ * receiver pin.
+ */
+struct CapturePulse {
+  /* The system tick in unit of milliseconds as obtained from millis(). */
+  uint32_t mMillis;
+  /* The level as obtained from digitalRead(). */
+  uint8_t mLevel;
+};
+
+/**
+ * Reads a recorded receiver signal level change by level change,
+ * without holding the capture in memory. A capture is a text file
+ * with one level change per line:
+ *
+ *   <millis> <level>
+ *
+ * Empty lines and lines starting with '#' are ignored. The first
+ * line gives the level at the start of the recording. The millis
+ * may overrun, as millis() does. The site at which the signal has
+ * been recorded is given by the name of the directory that holds
+ * the capture file.
+ */
+class CaptureReader {
+public:
+  CaptureReader() = default;
+  CaptureReader(const CaptureReader&) = delete;
+  CaptureReader& operator=(const CaptureReader&) = delete;
+  ~CaptureReader();
+
+  /**
+   * Open a capture file.
+   *
+   * @param[in] path The path of the capture file.
+   * @param[out] error The reason of the failure.
+   *
+   * @return false, if the file could not be opened.
+   */
+  bool open(const std::string& path, std::string& error);
+
+  /**
+   * Read the next level change.
+   *
+   * @param[out] pulse The level change.
+   * @param[out] error The reason of the failure. Left empty at the
+   *  end of the file.
+   *
+   * @return false, at the end of the file or if a line could not be
+   *  read or parsed.
+   */
+  bool next(CapturePulse& pulse, std::string& error);
+
+  /** @return The path of the capture file. */
+  const std::string& path() const {return mPath;}
+
+  /**
+   * @return The name of the directory that holds the file, or "."
+   *  if the path has no directory.
+   */
+  static std::string siteOf(const std::string& path);
+
+private:
+  FILE* mFile = nullptr;
+  std::string mPath;
+  unsigned mLineNumber = 0;
+};
+
+/**
+ * Generate synthetic captures for a number of sites. The reception
+ * quality degrades with the site number: site1 receives perfect
+ * pulses, higher sites suffer from increasing edge jitter, spurious
+ * pulses and dropouts. The signal always carries CET.
+ *
+ * The captures are written to <directory>/site<n>/capture<m>.txt.
+ *
+ * @return false, if a file could not be written.
+ */
+bool generateCaptures(const std::string& directory, unsigned sites,
+    unsigned capturesPerSite, unsigned minutesPerCapture, std::string& error);
+
+#endif /* DCF77_EXTRAS_CAPTURE_DECODER_CAPTURE_H_ */
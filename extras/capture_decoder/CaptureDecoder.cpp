@@ -0,0 +1,173 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "CaptureDecoder.h"
+#include <math.h>
+#include <stdlib.h>
+#include <chrono>
+
+namespace {
+
+/* The decoder reads the receiver pin once in begin(). */
+constexpr int CAPTURE_PIN = 0;
+/* Tolerated deviation of the frame time from the system tick. */
+constexpr int32_t FRAME_TOLERANCE_MILLIS = 500;
+constexpr uint32_t MIN_TICK_INTERVAL_MILLIS = 500;
+constexpr uint32_t MAX_TICK_INTERVAL_MILLIS = 2500;
+constexpr uint32_t MAX_TICK_JITTER_MILLIS = 100;
+
+void setMillis(const uint32_t millis) {
+  arduino_shim::setMicros(static_cast<uint64_t>(millis) * 1000);
+}
+
+DCF77time_t utcOf(const uint64_t dcf77frame) {
+  DCF77tm time;
+  DCF77Base::dcf77frame2time(time, dcf77frame);
+  return time.toTimeStamp() - DCF77Base::utcOffset(dcf77frame);
+}
+
+} // anonymous namespace
+
+void CaptureStats::merge(const CaptureStats& other) {
+  mCaptures += other.mCaptures;
+  mPulses += other.mPulses;
+  mDurationMillis += other.mDurationMillis;
+  mSecondTicks += other.mSecondTicks;
+  mFrames += other.mFrames;
+  mParityFailures += other.mParityFailures;
+  mSignalLost += other.mSignalLost;
+  mConsistentFrames += other.mConsistentFrames;
+  mInconsistentFrames += other.mInconsistentFrames;
+  mTickIntervals += other.mTickIntervals;
+  mOutlierIntervals += other.mOutlierIntervals;
+  mJitterSquareSum += other.mJitterSquareSum;
+  if(other.mJitterMax > mJitterMax) {
+    mJitterMax = other.mJitterMax;
+  }
+  mDecodeSeconds += other.mDecodeSeconds;
+}
+
+double CaptureStats::jitterRms() const {
+  return mTickIntervals > 0 ? sqrt(mJitterSquareSum / mTickIntervals) : 0;
+}
+
+CaptureStats CaptureDecoder::decode(CaptureReader& reader, std::string& error) {
+  CaptureStats stats;
+  stats.mCaptures = 1;
+  const auto start = std::chrono::steady_clock::now();
+
+  // The first line of the capture is the level at the start.
+  CapturePulse pulse;
+  if(not reader.next(pulse, error)) {
+    if(error.empty()) {
+      error = reader.path() + ": no pulses";
+    }
+    return stats;
+  }
+  const uint32_t firstMillis = pulse.mMillis;
+  setMillis(pulse.mMillis);
+  arduino_shim::setPinLevel(pulse.mLevel);
+  begin(CAPTURE_PIN, nullptr);
+
+  do {
+    // Polling before the level change detects the loss of the
+    // signal during a gap, as loop() would do.
+    pollEvents(pulse.mMillis, stats);
+    feed(pulse);
+    pollEvents(pulse.mMillis, stats);
+    stats.mPulses++;
+    stats.mDurationMillis = pulse.mMillis - firstMillis;
+  } while(reader.next(pulse, error));
+
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  stats.mDecodeSeconds = elapsed.count();
+  return stats;
+}
+
+void CaptureDecoder::feed(const CapturePulse& pulse) {
+  DCF77pulse dcf77signal;
+  dcf77signal.mPulseTime = pulse.mMillis;
+  dcf77signal.mPulseLevel = pulse.mLevel;
+  processPulse(dcf77signal);
+}
+
+void CaptureDecoder::pollEvents(const uint32_t systick, CaptureStats& stats) {
+  setMillis(systick);
+  DCF77event event;
+  while(poll(event)) {
+    switch(event.mType) {
+      case DCF77event::SECOND_TICK:
+        onSecondTick(event, stats);
+        break;
+      case DCF77event::MINUTE_FRAME:
+        onMinuteFrame(event, stats);
+        break;
+      case DCF77event::PARITY_FAILURE:
+        stats.mParityFailures++;
+        break;
+      case DCF77event::SIGNAL_LOST:
+        stats.mSignalLost++;
+        mHasPreviousTick = false;
+        break;
+    }
+  }
+}
+
+void CaptureDecoder::onSecondTick(const DCF77event& event, CaptureStats& stats) {
+  stats.mSecondTicks++;
+  if(mHasPreviousTick) {
+    const uint32_t interval = event.mSystick - mPreviousTick;
+    const uint32_t seconds = (interval + 500) / 1000;
+    const uint32_t jitter = abs(static_cast<int32_t>(interval - seconds * 1000));
+    if(interval < MIN_TICK_INTERVAL_MILLIS || interval > MAX_TICK_INTERVAL_MILLIS
+        || jitter > MAX_TICK_JITTER_MILLIS) {
+      stats.mOutlierIntervals++;
+    } else {
+      stats.mTickIntervals++;
+      stats.mJitterSquareSum += static_cast<double>(jitter) * jitter;
+      if(jitter > stats.mJitterMax) {
+        stats.mJitterMax = jitter;
+      }
+    }
+  }
+  mPreviousTick = event.mSystick;
+  mHasPreviousTick = true;
+}
+
+void CaptureDecoder::onMinuteFrame(const DCF77event& event, CaptureStats& stats) {
+  stats.mFrames++;
+  if(mHasPreviousFrame) {
+    const int64_t frameMillis =
+        static_cast<int64_t>(utcOf(event.mFrame) - utcOf(mPreviousFrame)) * 1000;
+    const uint32_t tickMillis = event.mSystick - mPreviousFrameTick;
+    if(llabs(frameMillis - tickMillis) <= FRAME_TOLERANCE_MILLIS) {
+      stats.mConsistentFrames++;
+    } else {
+      stats.mInconsistentFrames++;
+    }
+  }
+  mPreviousFrame = event.mFrame;
+  mPreviousFrameTick = event.mSystick;
+  mHasPreviousFrame = true;
+}
@@ -0,0 +1,101 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_EXTRAS_CAPTURE_DECODER_CAPTURE_DECODER_H_
+#define DCF77_EXTRAS_CAPTURE_DECODER_CAPTURE_DECODER_H_
+
+#include <stdint.h>
+#include "DCF77RX.h"
+#include "Capture.h"
+
+/**
+ * Reception and timing statistics of one or more captures.
+ */
+struct CaptureStats {
+  unsigned mCaptures = 0;
+  uint64_t mPulses = 0;
+  uint64_t mDurationMillis = 0;
+  /* Decoded events. */
+  uint64_t mSecondTicks = 0;
+  uint64_t mFrames = 0;
+  uint64_t mParityFailures = 0;
+  uint64_t mSignalLost = 0;
+  /* Frames whose time advanced in line with the system tick since
+   * the previous frame, and frames that did not. */
+  uint64_t mConsistentFrames = 0;
+  uint64_t mInconsistentFrames = 0;
+  /* Deviation of the second tick intervals from whole seconds, in
+   * unit of milliseconds. Intervals that deviate by more than 100 ms
+   * or that are not within 0.5..2.5 s are counted as outliers. */
+  uint64_t mTickIntervals = 0;
+  uint64_t mOutlierIntervals = 0;
+  double mJitterSquareSum = 0;
+  uint32_t mJitterMax = 0;
+  /* Time spent in reading and decoding the capture. */
+  double mDecodeSeconds = 0;
+
+  void merge(const CaptureStats& other);
+
+  /** @return The number of minutes that the captures span. */
+  double minutes() const {return mDurationMillis / 60000.0;}
+
+  /** @return The root mean square of the second tick jitter. */
+  double jitterRms() const;
+};
+
+/**
+ * Streams a capture through the decoder of the library as it is
+ * read, and collects the events that are fetched by poll(). Each
+ * worker thread uses its own instances. Must not be shared between
+ * threads.
+ */
+class CaptureDecoder : public DCF77Base {
+public:
+  /**
+   * Decode a capture from its start.
+   *
+   * @param[in] reader The opened capture.
+   * @param[out] error The reason of the failure.
+   *
+   * @return The statistics of the decoded part. error is set, if the
+   *  capture could not be read completely or holds no level change.
+   */
+  CaptureStats decode(CaptureReader& reader, std::string& error);
+
+private:
+  void feed(const CapturePulse& pulse);
+  void pollEvents(uint32_t systick, CaptureStats& stats);
+  void onSecondTick(const DCF77event& event, CaptureStats& stats);
+  void onMinuteFrame(const DCF77event& event, CaptureStats& stats);
+
+  uint32_t mPreviousTick = 0;
+  bool mHasPreviousTick = false;
+  uint64_t mPreviousFrame = 0;
+  uint32_t mPreviousFrameTick = 0;
+  bool mHasPreviousFrame = false;
+};
+
+#endif /* DCF77_EXTRAS_CAPTURE_DECODER_CAPTURE_DECODER_H_ */
@@ -0,0 +1,85 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "WorkStealingPool.h"
+#include <thread>
+
+WorkStealingPool::WorkStealingPool(const unsigned workers) : mSteals(0) {
+  for(unsigned i = 0; i < (workers > 0 ? workers : 1); i++) {
+    mWorkers.emplace_back(new Worker());
+  }
+}
+
+void WorkStealingPool::run(std::vector<Job> jobs) {
+  mSteals = 0;
+  for(size_t i = 0; i < jobs.size(); i++) {
+    Worker& worker = *mWorkers[i % mWorkers.size()];
+    std::lock_guard<std::mutex> lock(worker.mMutex);
+    worker.mJobs.push_back(std::move(jobs[i]));
+  }
+
+  // The calling thread is worker 0.
+  std::vector<std::thread> threads;
+  for(unsigned i = 1; i < workers(); i++) {
+    threads.emplace_back(&WorkStealingPool::work, this, i);
+  }
+  work(0);
+  for(std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+void WorkStealingPool::work(const unsigned self) {
+  Job job;
+  while(takeOwn(self, job) || steal(self, job)) {
+    job(self);
+  }
+}
+
+bool WorkStealingPool::takeOwn(const unsigned self, Job& job) {
+  Worker& worker = *mWorkers[self];
+  std::lock_guard<std::mutex> lock(worker.mMutex);
+  if(worker.mJobs.empty()) {
+    return false;
+  }
+  job = std::move(worker.mJobs.front());
+  worker.mJobs.pop_front();
+  return true;
+}
+
+bool WorkStealingPool::steal(const unsigned self, Job& job) {
+  // No new jobs arrive during a batch. Hence the batch is complete
+  // for this worker, once all other deques have been seen empty.
+  for(unsigned i = 1; i < workers(); i++) {
+    Worker& victim = *mWorkers[(self + i) % workers()];
+    std::lock_guard<std::mutex> lock(victim.mMutex);
+    if(not victim.mJobs.empty()) {
+      job = std::move(victim.mJobs.back());
+      victim.mJobs.pop_back();
+      mSteals++;
+      return true;
+    }
+  }
+  return false;
+}
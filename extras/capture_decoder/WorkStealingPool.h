@@ -0,0 +1,78 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_EXTRAS_CAPTURE_DECODER_WORK_STEALING_POOL_H_
+#define DCF77_EXTRAS_CAPTURE_DECODER_WORK_STEALING_POOL_H_
+
+#include <stddef.h>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * Runs a batch of independent jobs on a fixed number of threads.
+ *
+ * The jobs are dealt round robin onto one deque per worker. Each
+ * worker takes jobs from the front of its own deque. When that is
+ * empty, it steals from the back of the deques of the other workers,
+ * so that workers with short jobs help out workers with long ones.
+ * The jobs of a batch must not submit further jobs.
+ */
+class WorkStealingPool {
+public:
+  using Job = std::function<void(unsigned worker)>;
+
+  explicit WorkStealingPool(unsigned workers);
+
+  /**
+   * Run the jobs and return when all of them have been completed.
+   * The index of the worker that runs a job is passed to the job.
+   */
+  void run(std::vector<Job> jobs);
+
+  unsigned workers() const {return static_cast<unsigned>(mWorkers.size());}
+
+  /** @return The number of jobs stolen during the last run(). */
+  size_t steals() const {return mSteals;}
+
+private:
+  struct Worker {
+    std::mutex mMutex;
+    std::deque<Job> mJobs;
+  };
+
+  void work(unsigned self);
+  bool takeOwn(unsigned self, Job& job);
+  bool steal(unsigned self, Job& job);
+
+  std::vector<std::unique_ptr<Worker>> mWorkers;
+  std::atomic<size_t> mSteals;
+};
+
+#endif /* DCF77_EXTRAS_CAPTURE_DECODER_WORK_STEALING_POOL_H_ */
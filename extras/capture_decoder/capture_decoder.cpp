@@ -0,0 +1,258 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/**
+ * Decodes recorded receiver signals with the decoder of the library
+ * on the host, and reports the reception and timing statistics per
+ * site. The captures are decoded in parallel on a work stealing
+ * thread pool. Each job reads its capture and streams it through the
+ * decoder.
+ *
+ * Usage:
+ *   capture_decoder [-j threads] capture...
+ *     Decode the captures and print the statistics per site.
+ *   capture_decoder --bench [-j threads] capture...
+ *     Measure the throughput of reading and decoding for 1 up to the
+ *     given number of threads.
+ *   capture_decoder --generate directory [sites [captures [minutes]]]
+ *     Write synthetic captures. See generateCaptures().
+ *
+ * The number of threads defaults to the number of hardware threads.
+ * See CaptureReader for the file format.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Capture.h"
+#include "CaptureDecoder.h"
+#include "WorkStealingPool.h"
+
+namespace {
+
+constexpr unsigned BENCH_REPETITIONS = 3;
+
+double now() {
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int usage(const char* program) {
+  fprintf(stderr,
+      "usage: %s [-j threads] capture...\n"
+      "       %s --bench [-j threads] capture...\n"
+      "       %s --generate directory [sites [captures [minutes]]]\n",
+      program, program, program);
+  return 2;
+}
+
+bool parseCount(const char* arg, unsigned& count) {
+  char* end;
+  const unsigned long value = strtoul(arg, &end, 10);
+  if(end == arg || *end != '\0' || value == 0 || value > 100000) {
+    return false;
+  }
+  count = static_cast<unsigned>(value);
+  return true;
+}
+
+/**
+ * Decode the captures in parallel. Each job reads its capture and
+ * streams the pulses through the decoder, so that no capture is held
+ * in memory. Returns false and prints the errors, if a capture could
+ * not be read.
+ */
+bool decodeCaptures(WorkStealingPool& pool, const std::vector<std::string>& paths,
+    std::vector<CaptureStats>& stats) {
+  stats.assign(paths.size(), CaptureStats());
+  std::vector<std::string> errors(paths.size());
+  std::vector<WorkStealingPool::Job> jobs;
+  for(size_t i = 0; i < paths.size(); i++) {
+    jobs.push_back([&, i](unsigned) {
+      CaptureReader reader;
+      if(reader.open(paths[i], errors[i])) {
+        CaptureDecoder decoder;
+        stats[i] = decoder.decode(reader, errors[i]);
+      }
+    });
+  }
+  pool.run(std::move(jobs));
+
+  bool ok = true;
+  for(const std::string& error : errors) {
+    if(not error.empty()) {
+      fprintf(stderr, "%s\n", error.c_str());
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+void printStatsRow(const std::string& site, const CaptureStats& s) {
+  const double minutes = s.minutes();
+  printf("%-12s %4u %8.1f %7llu %7.1f %6llu %5llu %6llu %6llu %8.2f %6lu %7llu %9.2f\n",
+      site.c_str(), s.mCaptures, minutes,
+      static_cast<unsigned long long>(s.mFrames),
+      minutes >= 1 ? 100.0 * s.mFrames / static_cast<unsigned long long>(minutes) : 0.0,
+      static_cast<unsigned long long>(s.mParityFailures),
+      static_cast<unsigned long long>(s.mSignalLost),
+      static_cast<unsigned long long>(s.mConsistentFrames),
+      static_cast<unsigned long long>(s.mInconsistentFrames),
+      s.jitterRms(), static_cast<unsigned long>(s.mJitterMax),
+      static_cast<unsigned long long>(s.mOutlierIntervals),
+      s.mDecodeSeconds * 1000);
+}
+
+void printSiteStats(const std::vector<std::string>& paths,
+    const std::vector<CaptureStats>& stats) {
+  std::map<std::string, CaptureStats> sites;
+  CaptureStats total;
+  for(size_t i = 0; i < paths.size(); i++) {
+    sites[CaptureReader::siteOf(paths[i])].merge(stats[i]);
+    total.merge(stats[i]);
+  }
+
+  printf("%-12s %4s %8s %7s %7s %6s %5s %6s %6s %8s %6s %7s %9s\n",
+      "site", "capt", "minutes", "frames", "recept%", "parity", "lost",
+      "consis", "incons", "jitterms", "jitmax", "outlier", "decode_ms");
+  for(const auto& site : sites) {
+    printStatsRow(site.first, site.second);
+  }
+  printStatsRow("total", total);
+}
+
+int decode(const std::vector<std::string>& paths, const unsigned threads) {
+  WorkStealingPool pool(threads);
+  const double start = now();
+  std::vector<CaptureStats> stats;
+  if(not decodeCaptures(pool, paths, stats)) {
+    return 1;
+  }
+  const double elapsed = now() - start;
+
+  printSiteStats(paths, stats);
+  printf("%zu captures in %.3f s with %u threads, %zu jobs stolen\n",
+      paths.size(), elapsed, pool.workers(), pool.steals());
+  return 0;
+}
+
+int bench(const std::vector<std::string>& paths, const unsigned maxThreads) {
+  // A first run counts the pulses and warms up the file cache.
+  uint64_t pulses = 0;
+  {
+    WorkStealingPool pool(maxThreads);
+    std::vector<CaptureStats> stats;
+    if(not decodeCaptures(pool, paths, stats)) {
+      return 1;
+    }
+    for(const CaptureStats& s : stats) {
+      pulses += s.mPulses;
+    }
+  }
+
+  std::vector<unsigned> threadCounts;
+  for(unsigned threads = 1; threads < maxThreads; threads *= 2) {
+    threadCounts.push_back(threads);
+  }
+  threadCounts.push_back(maxThreads);
+
+  printf("%zu captures, %llu pulses, %u hardware threads, best of %u runs\n",
+      paths.size(), static_cast<unsigned long long>(pulses),
+      std::thread::hardware_concurrency(), BENCH_REPETITIONS);
+  printf("%7s %9s %12s %7s %6s\n", "threads", "wall_ms", "pulses/s", "speedup", "steals");
+  double baseline = 0;
+  for(const unsigned threads : threadCounts) {
+    WorkStealingPool pool(threads);
+    double best = 0;
+    size_t steals = 0;
+    for(unsigned i = 0; i < BENCH_REPETITIONS; i++) {
+      std::vector<CaptureStats> stats;
+      const double start = now();
+      if(not decodeCaptures(pool, paths, stats)) {
+        return 1;
+      }
+      const double elapsed = now() - start;
+      if(i == 0 || elapsed < best) {
+        best = elapsed;
+        steals = pool.steals();
+      }
+    }
+    if(threads == 1) {
+      baseline = best;
+    }
+    printf("%7u %9.2f %12.0f %7.2f %6zu\n", threads, best * 1000, pulses / best,
+        baseline / best, steals);
+  }
+  return 0;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+  if(argc > 1 && strcmp(argv[1], "--generate") == 0) {
+    unsigned counts[3] = {4, 4, 60}; // sites, captures per site, minutes per capture
+    if(argc < 3 || argc > 6) {
+      return usage(argv[0]);
+    }
+    for(int i = 3; i < argc; i++) {
+      if(not parseCount(argv[i], counts[i - 3])) {
+        return usage(argv[0]);
+      }
+    }
+    std::string error;
+    if(not generateCaptures(argv[2], counts[0], counts[1], counts[2], error)) {
+      fprintf(stderr, "%s\n", error.c_str());
+      return 1;
+    }
+    return 0;
+  }
+
+  bool benchMode = false;
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::string> paths;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--bench") == 0) {
+      benchMode = true;
+    } else if(strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      if(not parseCount(argv[++i], threads)) {
+        return usage(argv[0]);
+      }
+    } else if(argv[i][0] == '-') {
+      return usage(argv[0]);
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if(paths.empty()) {
+    return usage(argv[0]);
+  }
+
+  return benchMode ? bench(paths, threads) : decode(paths, threads);
+}
@@ -0,0 +1,84 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_EXTRAS_COMMON_DCF77FRAMEENCODER_H_
+#define DCF77_EXTRAS_COMMON_DCF77FRAMEENCODER_H_
+
+#include <stdint.h>
+#include <time.h>
+
+/* Flags of encodeDCF77Frame(). */
+constexpr unsigned DCF77_FRAME_CEST = 1;                  // Z1 instead of Z2
+constexpr unsigned DCF77_FRAME_DST_CHANGE_ANNOUNCED = 2;  // A1
+constexpr unsigned DCF77_FRAME_LEAP_SECOND_ANNOUNCED = 4; // A2
+
+/**
+ * Encode the dcf77 frame of a minute, as transmitted during the
+ * preceding minute. Used by the host tools to synthesize signals.
+ *
+ * @param[in] utc The start of the minute in seconds since 1 Jan 1970
+ *  UTC.
+ * @param[in] flags A combination of the DCF77_FRAME_ flags. The frame is
+ *  encoded in CET, unless DCF77_FRAME_CEST is given.
+ */
+inline uint64_t encodeDCF77Frame(const time_t utc, const unsigned flags = 0) {
+  struct Field {
+    static unsigned put(uint64_t& frame, const unsigned pos, const unsigned width,
+        const unsigned value) {
+      const unsigned bcd = (value / 10) << 4 | (value % 10);
+      unsigned parity = 0;
+      for(unsigned i = 0; i < width; i++) {
+        const unsigned bit = (bcd >> i) & 1;
+        frame |= static_cast<uint64_t>(bit) << (pos + i);
+        parity ^= bit;
+      }
+      return parity;
+    }
+  };
+
+  const bool cest = flags & DCF77_FRAME_CEST;
+  const time_t local = utc + (cest ? 7200 : 3600);
+  struct tm t;
+  gmtime_r(&local, &t);
+
+  uint64_t frame = 0;
+  frame |= static_cast<uint64_t>((flags & DCF77_FRAME_DST_CHANGE_ANNOUNCED) != 0) << 16; // A1
+  frame |= static_cast<uint64_t>(cest ? 1 : 2) << 17; // Z1: CEST, Z2: CET
+  frame |= static_cast<uint64_t>((flags & DCF77_FRAME_LEAP_SECOND_ANNOUNCED) != 0) << 19; // A2
+  frame |= static_cast<uint64_t>(1) << 20; // Start of time information
+  const unsigned p1 = Field::put(frame, 21, 7, t.tm_min);
+  frame |= static_cast<uint64_t>(p1) << 28;
+  const unsigned p2 = Field::put(frame, 29, 6, t.tm_hour);
+  frame |= static_cast<uint64_t>(p2) << 35;
+  unsigned p3 = Field::put(frame, 36, 6, t.tm_mday);
+  p3 ^= Field::put(frame, 42, 3, t.tm_wday == 0 ? 7 : t.tm_wday);
+  p3 ^= Field::put(frame, 45, 5, t.tm_mon + 1);
+  p3 ^= Field::put(frame, 50, 8, t.tm_year % 100);
+  frame |= static_cast<uint64_t>(p3) << 58;
+  return frame;
+}
+
+#endif /* DCF77_EXTRAS_COMMON_DCF77FRAMEENCODER_H_ */
@@ -0,0 +1,167 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/**
+ * Host check of DCF77FrameHistory across changes between CET and
+ * CEST and across the overrun of millis().
+ *
+ * Frames are pushed once per minute from 90 minutes before until 30
+ * minutes after the change, with the frames of the hour before the
+ * change announcing it (bit A1). The system tick overruns within
+ * that period. Every second is then converted by systickToUtc(),
+ * which must be monotonic and exact, and by systickToTime(), which
+ * must yield the local time and isdst, so that the repeated hour
+ * after CEST is unambiguous. The same is checked when extrapolating
+ * from a single anchor across the change. System ticks older than
+ * the oldest anchor must be rejected.
+ *
+ * The exit status is 1, if any check fails.
+ *
+ * Usage: verify_frame_history
+ */
+
+#include <stdio.h>
+#include "DCF77RX.h"
+#include "DCF77FrameEncoder.h"
+
+namespace {
+
+/* 2024-10-27 01:00:00 UTC, CEST changes to CET. */
+constexpr time_t CEST_END = 1729990800;
+/* 2025-03-30 01:00:00 UTC, CET changes to CEST. */
+constexpr time_t CEST_START = 1743296400;
+constexpr time_t FIRST_MINUTE = -90 * 60;
+constexpr time_t END_MINUTE = 30 * 60;
+/* The system tick at the first minute. millis() overruns 40
+ * minutes later. */
+constexpr uint32_t FIRST_SYSTICK = 0xFFFFFFFFUL - 40UL * 60 * 1000 + 1;
+constexpr unsigned MAX_REPORTED_FAILURES = 10;
+
+unsigned failures = 0;
+
+void reportFailure(const char* scenario, const char* what, const time_t utc) {
+  if(failures++ < MAX_REPORTED_FAILURES) {
+    printf("%s: %s at %lld\n", scenario, what, static_cast<long long>(utc));
+  }
+}
+
+class Transition {
+public:
+  Transition(const char* name, const time_t change, const bool cestBefore)
+    : mName(name), mChange(change), mCestBefore(cestBefore) {
+  }
+
+  const char* name() const {
+    return mName;
+  }
+
+  bool isCest(const time_t utc) const {
+    return utc < mChange ? mCestBefore : not mCestBefore;
+  }
+
+  uint32_t systickOf(const time_t utc) const {
+    return FIRST_SYSTICK + static_cast<uint32_t>((utc - (mChange + FIRST_MINUTE)) * 1000);
+  }
+
+  /* The frame received at the start of the minute utc. A1 is set
+   * during the hour before the change. */
+  uint64_t frameOf(const time_t utc) const {
+    unsigned flags = isCest(utc) ? DCF77_FRAME_CEST : 0;
+    if(utc > mChange - 3600 && utc <= mChange) {
+      flags |= DCF77_FRAME_DST_CHANGE_ANNOUNCED;
+    }
+    return encodeDCF77Frame(utc, flags);
+  }
+
+  /* Check the conversion of every second within first..end. */
+  template<size_t HISTORY_SIZE>
+  void checkSeconds(const DCF77FrameHistory<HISTORY_SIZE>& history,
+      const time_t first, const time_t end) const {
+    for(time_t utc = first; utc < end; utc++) {
+      const uint32_t systick = systickOf(utc) + 500;
+      DCF77time_t time;
+      unsigned millisec;
+      if(not history.systickToUtc(systick, time, &millisec)) {
+        reportFailure(mName, "systickToUtc() failed", utc);
+      } else if(time != utc || millisec != 500) {
+        reportFailure(mName, "wrong UTC", utc);
+      }
+
+      int isdst = -1;
+      const time_t local = utc + (isCest(utc) ? 7200 : 3600);
+      if(not history.systickToTime(systick, time, &millisec, &isdst)) {
+        reportFailure(mName, "systickToTime() failed", utc);
+      } else if(time != local || millisec != 500 || isdst != isCest(utc)) {
+        reportFailure(mName, "wrong local time", utc);
+      }
+    }
+  }
+
+  /* All frames in the history. */
+  void checkAnchors() const {
+    DCF77FrameHistory<128> history;
+    DCF77time_t time;
+    if(history.systickToUtc(systickOf(mChange), time, nullptr)) {
+      reportFailure(mName, "empty history resolved", mChange);
+    }
+    for(time_t minute = FIRST_MINUTE; minute < END_MINUTE; minute += 60) {
+      const time_t utc = mChange + minute;
+      history.push(frameOf(utc), systickOf(utc));
+    }
+    const time_t first = mChange + FIRST_MINUTE;
+    checkSeconds(history, first, mChange + END_MINUTE + 60);
+    if(history.systickToUtc(systickOf(first) - 1, time, nullptr)
+        || history.systickToTime(systickOf(first) - 1, time, nullptr)) {
+      reportFailure(mName, "older than oldest anchor resolved", first);
+    }
+  }
+
+  /* A single anchor 30 minutes before the change. */
+  void checkExtrapolation() const {
+    DCF77FrameHistory<1> history;
+    const time_t anchor = mChange - 30 * 60;
+    history.push(frameOf(anchor), systickOf(anchor));
+    checkSeconds(history, anchor, mChange + END_MINUTE);
+  }
+
+private:
+  const char* mName;
+  const time_t mChange;
+  const bool mCestBefore;
+};
+
+} // anonymous namespace
+
+int main() {
+  const Transition transitions[] = {
+    Transition("CEST to CET", CEST_END, true),
+    Transition("CET to CEST", CEST_START, false),
+  };
+  for(const Transition& transition : transitions) {
+    transition.checkAnchors();
+    transition.checkExtrapolation();
+  }
+  printf("frame history: %u failures\n", failures);
+  return failures == 0 ? 0 : 1;
+}
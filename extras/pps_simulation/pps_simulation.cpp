@@ -0,0 +1,326 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/**
+ * Host simulation of DCF77PPS, driven by the decoder of the library.
+ *
+ * A dcf77 signal is synthesized around the leap second at the end of
+ * 2016, with gaussian jitter on the receiver edges and a local clock
+ * that deviates from the true time. The edges are decoded by DCF77Base
+ * as from the pin interrupt, the events are polled every 2 ms as from
+ * loop(), and DCF77PPS::service() is called every 100 us as from a
+ * timer interrupt.
+ *
+ * Pulses are missing at random and always in second 1830, which is
+ * within a minute, and spurious short pulses are inserted at random.
+ * If no received frame has announced the leap second, the minute
+ * pulses are not checked from the leap second until the next frame.
+ *
+ * Once the loop has settled, every second must be marked by exactly
+ * one second pulse close to its true start. Once a valid frame has
+ * been received, every minute must be marked by a minute pulse,
+ * including the minute that follows the 61 second minute, and no
+ * other second. The exit status is 1 otherwise.
+ *
+ * Usage: pps_simulation [jitter_ms [ppm [missing_percent [glitch_percent]]]]
+ *   jitter_ms: Standard deviation of the edge jitter. Default is 5.
+ *   ppm: Deviation of the local clock. Default is 50.
+ *   missing_percent: Probability of a missing pulse. Default is 0.
+ *   glitch_percent: Probability of a spurious pulse per second.
+ *    Default is 0.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "DCF77RX.h"
+#include "DCF77FrameEncoder.h"
+
+namespace {
+
+/* The leap second is inserted right before 1 Jan 2017 0:00:00 UTC. */
+constexpr time_t LEAP_SECOND_END = 1483228800;
+constexpr time_t SIMULATION_START = LEAP_SECOND_END - 40 * 60;
+constexpr time_t SIMULATION_END = LEAP_SECOND_END + 10 * 60;
+/* Seconds after which the pulses are checked. */
+constexpr unsigned SETTLE_SECONDS = 600;
+/* Start of the local clock, such that micros() overruns early. */
+constexpr uint64_t LOCAL_START = (1ULL << 32) - 120000000ULL;
+constexpr uint32_t SERVICE_PERIOD_MICROS = 100;
+constexpr uint32_t POLL_PERIOD_MICROS = 2000;
+constexpr double MAX_PULSE_ERROR_MICROS = 5000;
+/* The pulse of this second is always missing. */
+constexpr unsigned MISSING_PULSE_SECOND = 1830;
+
+constexpr int RECEIVER_PIN = 0;
+constexpr int PPS_PIN = 1;
+constexpr int MINUTE_PIN = 2;
+
+struct Edge {
+  double mTrueMicros;
+  uint8_t mLevel;
+};
+
+class SimulatedReceiver : public DCF77Base {
+public:
+  void begin() {
+    DCF77Base::begin(RECEIVER_PIN, nullptr);
+  }
+
+  void feed(const uint8_t level) {
+    DCF77pulse dcf77signal;
+    dcf77signal.mPulseTime = millis();
+    dcf77signal.mPulseLevel = level;
+    processPulse(dcf77signal);
+  }
+};
+
+uint64_t simulationNow;
+std::vector<uint64_t> ppsPulses;
+std::vector<uint64_t> minutePulses;
+
+void onDigitalWrite(const int pin, const int level) {
+  if(level == HIGH) {
+    (pin == PPS_PIN ? ppsPulses : minutePulses).push_back(simulationNow);
+  }
+}
+
+struct SignalQuality {
+  double mJitterMicros;
+  double mMissingRate;
+  double mGlitchRate;
+};
+
+/**
+ * Synthesize the receiver edges. The minute before LEAP_SECOND_END
+ * has 61 seconds. Returns the true start of each minute in unit of
+ * seconds since the start of the simulation.
+ */
+std::vector<unsigned> synthesize(std::vector<Edge>& edges, const SignalQuality& quality) {
+  std::mt19937 rng(1);
+  std::normal_distribution<double> jitter(0, quality.mJitterMicros);
+  std::uniform_real_distribution<double> chance(0.0, 1.0);
+  std::uniform_real_distribution<double> glitchOffset(300000, 800000);
+  std::uniform_real_distribution<double> glitchWidth(10000, 60000);
+  std::vector<unsigned> minuteStarts;
+  unsigned second = 0;
+  for(time_t minute = SIMULATION_START; minute < SIMULATION_END; minute += 60) {
+    const bool isLeapMinute = minute + 60 == LEAP_SECOND_END;
+    // A2 is set in the frames that are transmitted within the hour
+    // before the leap second.
+    const bool leapSecondAnnounced =
+        minute >= LEAP_SECOND_END - 3600 && minute < LEAP_SECOND_END;
+    const uint64_t frame = encodeDCF77Frame(minute + 60,
+        leapSecondAnnounced ? DCF77_FRAME_LEAP_SECOND_ANNOUNCED : 0);
+    const unsigned bits = isLeapMinute ? 60 : 59;
+    minuteStarts.push_back(second);
+    for(unsigned i = 0; i < (isLeapMinute ? 61u : 60u); i++, second++) {
+      const double start = second * 1e6;
+      const bool isMissing = second == MISSING_PULSE_SECOND || chance(rng) < quality.mMissingRate;
+      if(i < bits && not isMissing) {
+        const unsigned bit = (frame >> i) & 1; // Bit 59 of the leap minute is 0.
+        edges.push_back({start + jitter(rng), LOW});
+        edges.push_back({start + (bit ? 200000 : 100000) + jitter(rng), HIGH});
+      }
+      if(chance(rng) < quality.mGlitchRate) {
+        const double glitchStart = start + glitchOffset(rng);
+        edges.push_back({glitchStart, LOW});
+        edges.push_back({glitchStart + glitchWidth(rng), HIGH});
+      }
+    }
+  }
+  return minuteStarts;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+  const double jitterMillis = argc > 1 ? atof(argv[1]) : 5;
+  const double ppm = argc > 2 ? atof(argv[2]) : 50;
+  const double missingPercent = argc > 3 ? atof(argv[3]) : 0;
+  const double glitchPercent = argc > 4 ? atof(argv[4]) : 0;
+  const double localRate = 1 + ppm * 1e-6;
+
+  std::vector<Edge> edges;
+  const SignalQuality quality = {jitterMillis * 1000, missingPercent / 100, glitchPercent / 100};
+  const std::vector<unsigned> minuteStarts = synthesize(edges, quality);
+  const unsigned seconds = (SIMULATION_END - SIMULATION_START) + 1;
+  auto localOf = [&](const double trueMicros) {
+    return LOCAL_START + static_cast<uint64_t>(trueMicros * localRate);
+  };
+
+  arduino_shim::setDigitalWriteHandler(onDigitalWrite);
+  arduino_shim::setMicros(LOCAL_START);
+  arduino_shim::setPinLevel(HIGH);
+  SimulatedReceiver receiver;
+  DCF77PPS pps(PPS_PIN, MINUTE_PIN);
+  receiver.begin();
+  pps.begin();
+
+  unsigned frames = 0;
+  std::vector<uint64_t> frameMicros;
+  std::vector<bool> frameAnnouncesLeapSecond;
+  size_t nextEdge = 0;
+  const uint64_t end = localOf(seconds * 1e6);
+  for(simulationNow = LOCAL_START; simulationNow < end; simulationNow += SERVICE_PERIOD_MICROS) {
+    // Pin interrupts.
+    while(nextEdge < edges.size() && localOf(edges[nextEdge].mTrueMicros) <= simulationNow) {
+      arduino_shim::setMicros(localOf(edges[nextEdge].mTrueMicros));
+      receiver.feed(edges[nextEdge].mLevel);
+      nextEdge++;
+    }
+    arduino_shim::setMicros(simulationNow);
+
+    // loop()
+    if((simulationNow - LOCAL_START) % POLL_PERIOD_MICROS == 0) {
+      DCF77Base::DCF77event event;
+      while(receiver.poll(event)) {
+        if(event.mType == DCF77Base::DCF77event::MINUTE_FRAME) {
+          frames++;
+          frameMicros.push_back(simulationNow);
+          frameAnnouncesLeapSecond.push_back(DCF77Base::leapSecondAnnounced(event.mFrame));
+          pps.onMinuteFrame(event.mFrame);
+        } else if(event.mType == DCF77Base::DCF77event::SECOND_TICK) {
+          pps.onSecondTick(event.mSystick, event.mSecond);
+        }
+      }
+    }
+
+    // Timer interrupt.
+    pps.service(micros());
+  }
+
+  // Map the pulses to the true seconds.
+  auto trueSecondOf = [&](const uint64_t local, double& errorMicros) {
+    const double trueMicros = (local - LOCAL_START) / localRate;
+    const long second = lround(trueMicros / 1e6);
+    errorMicros = trueMicros - second * 1e6;
+    return second;
+  };
+
+  unsigned failures = 0;
+  std::vector<unsigned> pulsesPerSecond(seconds + 1, 0);
+  double sum = 0;
+  double squareSum = 0;
+  double maxError = 0;
+  unsigned checked = 0;
+  for(const uint64_t pulse : ppsPulses) {
+    double error;
+    const long second = trueSecondOf(pulse, error);
+    if(second < SETTLE_SECONDS || second >= static_cast<long>(seconds)) {
+      continue;
+    }
+    pulsesPerSecond[second]++;
+    checked++;
+    sum += error;
+    squareSum += error * error;
+    maxError = std::max(maxError, fabs(error));
+    if(fabs(error) > MAX_PULSE_ERROR_MICROS) {
+      printf("second pulse %ld off by %.0f us\n", second, error);
+      failures++;
+    }
+  }
+  for(unsigned second = SETTLE_SECONDS; second < seconds; second++) {
+    if(pulsesPerSecond[second] != 1) {
+      printf("second %u: %u second pulses\n", second, pulsesPerSecond[second]);
+      failures++;
+    }
+  }
+
+  // The minute phase is known after the minute of the first valid
+  // frame. The pulse of that minute may or may not be marked.
+  double error;
+  std::vector<long> frameSeconds;
+  for(const uint64_t frame : frameMicros) {
+    frameSeconds.push_back(trueSecondOf(frame, error));
+  }
+  const long firstFrameSecond = frames > 0 ? frameSeconds.front() : seconds;
+  const long firstMinuteSecond = std::max<long>(SETTLE_SECONDS, firstFrameSecond + 1);
+
+  // The leap second is only known, if a frame announcing it has been
+  // received within its hour. Otherwise, the minute pulses are off by
+  // one second until the next frame.
+  long leapSecondEnd = 0;
+  for(size_t i = 1; i < minuteStarts.size(); i++) {
+    if(minuteStarts[i] - minuteStarts[i - 1] > 60) {
+      leapSecondEnd = minuteStarts[i];
+    }
+  }
+  bool isLeapSecondKnown = false;
+  long frameAfterLeapSecond = seconds;
+  for(size_t i = 0; i < frameSeconds.size(); i++) {
+    if(frameSeconds[i] < leapSecondEnd) {
+      isLeapSecondKnown = isLeapSecondKnown || frameAnnouncesLeapSecond[i];
+    } else if(frameAfterLeapSecond == static_cast<long>(seconds)) {
+      frameAfterLeapSecond = frameSeconds[i];
+    }
+  }
+  auto isChecked = [&](const long second) {
+    if(second < firstMinuteSecond || second >= static_cast<long>(seconds)) {
+      return false;
+    }
+    return isLeapSecondKnown || second < leapSecondEnd - 1 || second > frameAfterLeapSecond;
+  };
+  if(not isLeapSecondKnown) {
+    printf("leap second not announced by any received frame,"
+        " minute pulses unchecked until second %ld\n", frameAfterLeapSecond);
+  }
+
+  std::vector<long> minutes;
+  for(const uint64_t pulse : minutePulses) {
+    const long second = trueSecondOf(pulse, error);
+    if(isChecked(second)) {
+      minutes.push_back(second);
+    }
+  }
+  std::vector<long> expectedMinutes;
+  for(const unsigned second : minuteStarts) {
+    if(isChecked(second)) {
+      expectedMinutes.push_back(second);
+    }
+  }
+  if(minutes != expectedMinutes) {
+    printf("minute pulses at seconds:");
+    for(const long second : minutes) {
+      printf(" %ld", second);
+    }
+    printf("\nexpected:");
+    for(const long second : expectedMinutes) {
+      printf(" %ld", second);
+    }
+    printf("\n");
+    failures++;
+  }
+
+  const double mean = checked > 0 ? sum / checked : 0;
+  const double sd = checked > 0 ? sqrt(squareSum / checked - mean * mean) : 0;
+  printf("edge jitter %.1f ms, clock %+.0f ppm, %.0f%% missing, %.0f%% glitches:"
+      " %u frames, %u second pulses checked, offset %.0f us, jitter %.0f us rms, %.0f us max, %zu minute pulses, %u failures\n",
+      jitterMillis, ppm, missingPercent, glitchPercent, frames, checked, mean, sd, maxError, minutes.size(), failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+#!/usr/bin/env bash
+#
+# DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+# 2025 Wolfgang Schmieder.  All right reserved.
+#
+# Report the flash and RAM usage of the library features for several
+# architectures. Each feature is compiled as a small sketch with
+# arduino-cli. The receiver is printed as difference to the sketch
+# without the library, every other feature as difference to the
+# receiver, since each of them includes the receiver.
+#
+# Usage: extras/size_report.sh [FQBN...]
+#
+# The cores for the given FQBNs must be installed, e.g.
+#   arduino-cli core install arduino:avr arduino:sam esp32:esp32
+#
+
+set -euo pipefail
+
+LIBRARY_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+FQBNS=("$@")
+if [ ${#FQBNS[@]} -eq 0 ]; then
+  FQBNS=(arduino:avr:uno arduino:sam:arduino_due_x esp32:esp32:esp32s3)
+fi
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+# Feature name, extra compiler flags and sketch body.
+FEATURES=(
+  "empty||"
+  "receiver|-DDCF77_EVENT_QUEUE_SIZE=0|DCF77RX<2> rx;"
+  "receiver+poll||DCF77RX<2> rx; DCF77Base::DCF77event e;"
+  "receiver+poll(16)|-DDCF77_EVENT_QUEUE_SIZE=16|DCF77RX<2> rx; DCF77Base::DCF77event e;"
+  "receiver(nocallback)|-DDCF77_EVENT_QUEUE_SIZE=0 -DDCF77_FRAME_CALLBACK=false|DCF77RX<2> rx;"
+  "receiver+poll(static)|-DDCF77_FRAME_CALLBACK=false|using RX = DCF77RXStatic<2>; DCF77Base::DCF77event e;"
+  "frame2time|-DDCF77_EVENT_QUEUE_SIZE=0|DCF77RX<2> rx; DCF77tm tm;"
+  "frame2time(generic)|-DDCF77_EVENT_QUEUE_SIZE=0 -DDCF77_FAST_TIME_ARITHMETIC=false|DCF77RX<2> rx; DCF77tm tm;"
+  "softclock|-DDCF77_EVENT_QUEUE_SIZE=0|DCF77RX<2> rx; DCF77SoftClock clk;"
+  "framehistory<8>|-DDCF77_EVENT_QUEUE_SIZE=0|DCF77RX<2> rx; DCF77FrameHistory<8> hist;"
+  "pps|-DDCF77_EVENT_QUEUE_SIZE=0|DCF77RX<2> rx; DCF77PPS pps(3, 4);"
+)
+
+# Statements in loop() that keep the feature from being optimized away.
+usage() {
+  case "$1" in
+    empty)          echo "" ;;
+    *static*)       echo "RX::begin(); if(RX::poll(e)) {Serial.print(e.mSystick);}" ;;
+    *poll*)         echo "rx.begin(); if(rx.poll(e)) {Serial.print(e.mSystick);}" ;;
+    receiver*)      echo "rx.begin();" ;;
+    frame2time*)    echo "rx.begin(); DCF77Base::dcf77frame2time(tm, millis()); tm.set(tm.toTimeStamp(), 0); Serial.print(tm);" ;;
+    softclock)      echo "rx.begin(); clk.set(millis(), 0); DCF77time_t t; if(clk.localNow(t, nullptr)) {Serial.print(static_cast<unsigned long>(t));}" ;;
+    pps)            echo "rx.begin(); pps.begin(); pps.onMinuteFrame(millis()); pps.onSecondTick(millis(), 0); pps.service(micros());" ;;
+    framehistory*)  echo "rx.begin(); hist.push(millis(), 0); DCF77time_t t; if(hist.systickToTime(1, t, nullptr)) {Serial.print(static_cast<unsigned long>(t));}" ;;
+  esac
+}
+
+compile() {
+  local fqbn="$1" name="$2" flags="$3" decl="$4"
+  local sketch="$WORK_DIR/$name/size"
+  sketch="${sketch//[<>()+]/_}"
+  mkdir -p "$sketch"
+  local body
+  body="$(usage "$name")"
+  cat > "$sketch/size.ino" <<SKETCH
+#include <DCF77RX.h>
+$decl
+void setup() {Serial.begin(9600);}
+void loop() {$body}
+SKETCH
+  local output
+  if ! output="$(arduino-cli compile --fqbn "$fqbn" --library "$LIBRARY_DIR" \
+      --build-property "compiler.cpp.extra_flags=$flags" "$sketch" 2>&1)"; then
+    echo "error: compiling feature '$name' for $fqbn failed:" >&2
+    echo "$output" >&2
+    return 1
+  fi
+  local flash ram
+  flash="$(awk '/Sketch uses/ {gsub(/,/, "", $3); print $3}' <<< "$output")"
+  ram="$(awk '/Global variables use/ {gsub(/,/, "", $4); print $4}' <<< "$output")"
+  if ! [[ "$flash" =~ ^[0-9]+$ && "$ram" =~ ^[0-9]+$ ]]; then
+    echo "error: no size report for feature '$name' on $fqbn:" >&2
+    echo "$output" >&2
+    return 1
+  fi
+  echo "$flash $ram"
+}
+
+for fqbn in "${FQBNS[@]}"; do
+  echo "== $fqbn"
+  printf "%-22s %10s %10s\n" "feature" "flash" "ram"
+  base_flash=0
+  base_ram=0
+  for feature in "${FEATURES[@]}"; do
+    IFS='|' read -r name flags decl <<< "$feature"
+    # A failing compile() aborts the script due to set -e.
+    sizes="$(compile "$fqbn" "$name" "$flags" "$decl")"
+    read -r flash ram <<< "$sizes"
+    if [ "$name" = "empty" ]; then
+      printf "%-22s %10d %10d\n" "$name" "$flash" "$ram"
+    else
+      printf "%-22s %+10d %+10d\n" "$name" $((flash - base_flash)) $((ram - base_ram))
+    fi
+    # The receiver is the base of the other features.
+    if [ "$name" = "empty" ] || [ "$name" = "receiver" ]; then
+      base_flash=$flash
+      base_ram=$ram
+    fi
+  done
+done
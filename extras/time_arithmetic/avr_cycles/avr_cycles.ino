@@ -0,0 +1,148 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/**
+ * Measures the CPU cycles that DCF77tm::set() and DCF77tm::toTimeStamp()
+ * take on an AVR. The cycles are counted with Timer1 running at the
+ * CPU clock.
+ *
+ * Build and run the sketch twice to compare the fast 16-bit time
+ * arithmetic with the generic one, e.g.
+ *
+ *   arduino-cli compile -b arduino:avr:uno --library ../../.. \
+ *     --build-property "build.extra_flags=-DDCF77_FAST_TIME_ARITHMETIC=true"
+ *   arduino-cli compile -b arduino:avr:uno --library ../../.. \
+ *     --build-property "build.extra_flags=-DDCF77_FAST_TIME_ARITHMETIC=false"
+ *
+ * The result is printed on Serial. Without hardware, the sketch can
+ * be run in simavr, which forwards the UART output to the console:
+ *
+ *   run_avr -m atmega328p -f 16000000 avr_cycles.ino.elf
+ */
+
+#include "DCF77RX.h"
+
+#ifndef ARDUINO_ARCH_AVR
+#error "This sketch measures cycles with the AVR Timer1."
+#endif
+
+namespace {
+
+const uint32_t TIMESTAMPS[] = {
+  946684800UL,  // 2000-01-01 00:00:00
+  951782400UL,  // 2000-02-29 00:00:00
+  1206835199UL, // 2008-03-29 23:59:59
+  1483228799UL, // 2016-12-31 23:59:59
+  1743897600UL, // 2025-04-06 00:00:00
+  2147483647UL, // 2038-01-19 03:14:07
+  3029529599UL, // 2065-12-31 23:59:59
+  4102444799UL, // 2099-12-31 23:59:59
+};
+
+constexpr size_t TIMESTAMP_COUNT = sizeof(TIMESTAMPS) / sizeof(TIMESTAMPS[0]);
+
+/* Prevent the calls from being optimized away. */
+volatile uint32_t sink;
+
+inline void startCycleCounter() {
+  TCNT1 = 0;
+}
+
+inline uint16_t readCycleCounter() {
+  return TCNT1;
+}
+
+uint16_t measureOverhead() {
+  noInterrupts();
+  startCycleCounter();
+  const uint16_t cycles = readCycleCounter();
+  interrupts();
+  return cycles;
+}
+
+uint16_t measureSet(const uint32_t timestamp, DCF77tm& tm) {
+  noInterrupts();
+  startCycleCounter();
+  tm.set(timestamp, 0);
+  const uint16_t cycles = readCycleCounter();
+  interrupts();
+  return cycles;
+}
+
+uint16_t measureToTimeStamp(const DCF77tm& tm) {
+  noInterrupts();
+  startCycleCounter();
+  sink = tm.toTimeStamp();
+  const uint16_t cycles = readCycleCounter();
+  interrupts();
+  return cycles;
+}
+
+} // anonymous namespace
+
+void setup() {
+  Serial.begin(9600);
+
+  // Timer1 in normal mode, clocked with the CPU clock.
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);
+
+  const uint16_t overhead = measureOverhead();
+  uint32_t setCycles = 0;
+  uint32_t toTimeStampCycles = 0;
+  uint16_t setMax = 0;
+  uint16_t toTimeStampMax = 0;
+
+  for(size_t i = 0; i < TIMESTAMP_COUNT; i++) {
+    DCF77tm tm;
+    const uint16_t setC = measureSet(TIMESTAMPS[i], tm) - overhead;
+    const uint16_t toTimeStampC = measureToTimeStamp(tm) - overhead;
+    if(sink != TIMESTAMPS[i]) {
+      Serial.print("Round trip failed at ");
+      Serial.println(TIMESTAMPS[i]);
+    }
+    setCycles += setC;
+    toTimeStampCycles += toTimeStampC;
+    if(setC > setMax) {setMax = setC;}
+    if(toTimeStampC > toTimeStampMax) {toTimeStampMax = toTimeStampC;}
+  }
+
+  Serial.print("DCF77_FAST_TIME_ARITHMETIC=");
+#ifdef DCF77_FAST_TIME_ARITHMETIC
+  Serial.println(DCF77_FAST_TIME_ARITHMETIC ? "true" : "false");
+#else
+  Serial.println("default");
+#endif
+  Serial.print("set() cycles avg/max: ");
+  Serial.print(setCycles / TIMESTAMP_COUNT);
+  Serial.print('/');
+  Serial.println(setMax);
+  Serial.print("toTimeStamp() cycles avg/max: ");
+  Serial.print(toTimeStampCycles / TIMESTAMP_COUNT);
+  Serial.print('/');
+  Serial.println(toTimeStampMax);
+}
+
+void loop() {
+}
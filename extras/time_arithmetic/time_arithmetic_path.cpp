@@ -0,0 +1,70 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/**
+ * Compiles DCF77tm.cpp a second time into its own translation unit,
+ * with the class renamed and DCF77_FAST_TIME_ARITHMETIC forced to
+ * the value given on the command line. Hence the generic and the
+ * fast implementation can be linked into the same program and be
+ * compared with each other.
+ *
+ * To be compiled with e.g.
+ *   -DTM_PATH=fast -DDCF77tm=DCF77tm_fast -DDCF77_FAST_TIME_ARITHMETIC=true
+ */
+
+#include "internal/DCF77tm.cpp"
+#include "time_arithmetic_path.h"
+
+#define TM_PATH_CONCAT2(path, name) path##_##name
+#define TM_PATH_CONCAT(path, name) TM_PATH_CONCAT2(path, name)
+#define TM_PATH_FUNCTION(name) TM_PATH_CONCAT(TM_PATH, name)
+
+void TM_PATH_FUNCTION(set)(const uint32_t timestamp, TmFields& fields) {
+  DCF77tm tm;
+  tm.tm_yday = -1; // Detect whether set() assigns tm_yday.
+  tm.set(timestamp, 1);
+  fields.mSec = tm.tm_sec;
+  fields.mMin = tm.tm_min;
+  fields.mHour = tm.tm_hour;
+  fields.mMday = tm.tm_mday;
+  fields.mMon = tm.tm_mon;
+  fields.mYear = tm.tm_year;
+  fields.mWday = tm.tm_wday;
+  fields.mYday = tm.tm_yday;
+  fields.mIsdst = tm.tm_isdst;
+}
+
+uint32_t TM_PATH_FUNCTION(toTimeStamp)(const TmFields& fields) {
+  DCF77tm tm;
+  tm.tm_sec = fields.mSec;
+  tm.tm_min = fields.mMin;
+  tm.tm_hour = fields.mHour;
+  tm.tm_mday = fields.mMday;
+  tm.tm_mon = fields.mMon;
+  tm.tm_year = fields.mYear;
+  tm.tm_wday = fields.mWday;
+  tm.tm_yday = fields.mYday;
+  tm.tm_isdst = fields.mIsdst;
+  return tm.toTimeStamp();
+}
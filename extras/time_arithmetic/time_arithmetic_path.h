@@ -0,0 +1,57 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_EXTRAS_TIME_ARITHMETIC_PATH_H_
+#define DCF77_EXTRAS_TIME_ARITHMETIC_PATH_H_
+
+#include <stdint.h>
+
+/** The fields of a DCF77tm, independent of the class name. */
+struct TmFields {
+  int mSec;
+  int mMin;
+  int mHour;
+  int mMday;
+  int mMon;
+  int mYear;
+  int mWday;
+  int mYday;
+  int mIsdst;
+
+  bool operator==(const TmFields& other) const {
+    return mSec == other.mSec && mMin == other.mMin && mHour == other.mHour
+        && mMday == other.mMday && mMon == other.mMon && mYear == other.mYear
+        && mWday == other.mWday && mYday == other.mYday && mIsdst == other.mIsdst;
+  }
+};
+
+void generic_set(uint32_t timestamp, TmFields& fields);
+uint32_t generic_toTimeStamp(const TmFields& fields);
+
+void fast_set(uint32_t timestamp, TmFields& fields);
+uint32_t fast_toTimeStamp(const TmFields& fields);
+
+#endif /* DCF77_EXTRAS_TIME_ARITHMETIC_PATH_H_ */
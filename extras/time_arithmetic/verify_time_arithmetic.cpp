@@ -0,0 +1,105 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/**
+ * Exhaustive host check of the fast 16-bit time arithmetic
+ * (DCF77_FAST_TIME_ARITHMETIC) against the generic implementation.
+ *
+ * Every second of the range 2000..2099 plus a margin on both sides
+ * is converted with DCF77tm::set() by both implementations and the
+ * resulting fields are compared. The fields are then converted back
+ * with DCF77tm::toTimeStamp() by both implementations, which must
+ * yield the original time stamp.
+ *
+ * Usage: verify_time_arithmetic [step]
+ *   step: Check every step-th second only. Default is 1.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "time_arithmetic_path.h"
+
+namespace {
+
+constexpr uint64_t FIRST = 946684800ULL - 200000;  // 2000-01-01 minus margin
+constexpr uint64_t END   = 4102444800ULL + 200000; // 2100-01-01 plus margin
+constexpr uint64_t MAX_REPORTED_MISMATCHES = 10;
+
+std::atomic<uint64_t> mismatches(0);
+
+void reportMismatch(const char* what, const uint64_t timestamp) {
+  if(mismatches++ < MAX_REPORTED_MISMATCHES) {
+    printf("%s mismatch at %llu\n", what, static_cast<unsigned long long>(timestamp));
+  }
+}
+
+void check(const uint64_t first, const uint64_t stride) {
+  for(uint64_t t = first; t < END; t += stride) {
+    const uint32_t timestamp = static_cast<uint32_t>(t);
+    TmFields generic;
+    TmFields fast;
+    generic_set(timestamp, generic);
+    fast_set(timestamp, fast);
+    if(not (generic == fast)) {
+      reportMismatch("set()", t);
+    }
+    if(generic_toTimeStamp(generic) != timestamp) {
+      reportMismatch("generic toTimeStamp()", t);
+    }
+    if(fast_toTimeStamp(generic) != timestamp) {
+      reportMismatch("fast toTimeStamp()", t);
+    }
+  }
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+  const uint64_t step = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1;
+  if(step == 0) {
+    fprintf(stderr, "usage: %s [step]\n", argv[0]);
+    return 2;
+  }
+
+  const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for(unsigned i = 0; i < threads; i++) {
+    workers.emplace_back(check, FIRST + i * step, threads * step);
+  }
+  for(std::thread& worker : workers) {
+    worker.join();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  printf("checked %llu time stamps in %.1f s with %u threads: %llu mismatches\n",
+      static_cast<unsigned long long>((END - FIRST + step - 1) / step),
+      elapsed.count(), threads, static_cast<unsigned long long>(mismatches.load()));
+  return mismatches.load() == 0 ? 0 : 1;
+}
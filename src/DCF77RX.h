@@ -30,6 +30,9 @@
 #include <stdint.h>
 #include "internal/ISR_ATTR.h"
 #include "internal/DCF77Base.h"
+#include "internal/DCF77FrameHistory.h"
+#include "internal/DCF77SoftClock.h"
+#include "internal/DCF77PPS.h"
 #include <Arduino.h>
 
 /**
@@ -65,6 +68,9 @@
  *   ...
  * }
  *
+ * Alternatively, received frames and other events can be fetched
+ * from within loop() by DCF77Base::poll(), without overriding
+ * onDCF77FrameReceived().
  */
 template<int RECEIVER_PIN> class DCF77RX : public DCF77Base {
 public:
@@ -100,4 +106,72 @@ template<int RECEIVER_PIN>
 
 DCF77Base *DCF77RX<RECEIVER_PIN>::mInstance = nullptr;
 
+/**
+ * DCF77RXStatic is a variant of DCF77RX without instance pointer.
+ * The receiver is a static member, that is addressed directly by the
+ * interrupt handler. Events are fetched by poll(). Together with
+ * DCF77_FRAME_CALLBACK set to false, the receiver carries no vtable
+ * pointer either.
+ *
+ * Usage:
+ *
+ * static constexpr int DCF77_PIN = 3;
+ * using MyDcf77Receiver = DCF77RXStatic<DCF77_PIN>;
+ *
+ * void setup() {
+ *   ...
+ *   MyDcf77Receiver::begin();
+ *   ...
+ * }
+ *
+ * void loop() {
+ *   DCF77Base::DCF77event event;
+ *   while(MyDcf77Receiver::poll(event)) {
+ *     ...
+ *   }
+ * }
+ */
+template<int RECEIVER_PIN> class DCF77RXStatic {
+public:
+	/**
+	 * Start receiving dcf77 frames. To be called once during
+	 * setup().
+	 */
+	static void begin() {
+		mReceiver.begin();
+	}
+
+#if DCF77_EVENT_QUEUE_SIZE > 0
+	/**
+	 * See DCF77Base::poll().
+	 */
+	static bool poll(DCF77Base::DCF77event& event) {
+		return mReceiver.poll(event);
+	}
+#endif
+
+private:
+	class Receiver : public DCF77Base {
+	public:
+		void begin() {
+			DCF77Base::begin(RECEIVER_PIN, intHandler);
+		}
+	};
+
+	/* The receiver that is responsible for pin RECEIVE_PIN. */
+	static Receiver mReceiver;
+
+	/**
+	 * The interrupt handler that is called upon a level change on
+	 * the RECEIVER_PIN.
+	 */
+	TEXT_ISR_ATTR_0
+	static void intHandler() {
+		mReceiver.onPinInterrupt(RECEIVER_PIN);
+	}
+};
+
+template<int RECEIVER_PIN>
+typename DCF77RXStatic<RECEIVER_PIN>::Receiver DCF77RXStatic<RECEIVER_PIN>::mReceiver;
+
 #endif /* DCF77RX_HPP_ */
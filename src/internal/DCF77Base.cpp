@@ -35,6 +35,17 @@ constexpr int DCF_SPLIT_MILLIS = 170;
  * a new minute.
  */
 constexpr int DCF_SYNC_MILLIS = 1200;
+/**
+ * A pulse starts every second, except for second 59. Assume the
+ * signal to be lost, if there is no pulse for a longer time.
+ */
+constexpr uint32_t DCF_SIGNAL_LOST_MILLIS = 3000;
+
+/**
+ * Prevent the compiler from moving memory accesses across this point.
+ * Used to publish a mailbox entry only after it has been written.
+ */
+#define DCF77_COMPILER_BARRIER() __asm__ __volatile__("" ::: "memory")
 
 
 constexpr int DCF_SIGNAL_STATE_LOW  = 0;
@@ -62,13 +73,6 @@ struct DCF77bits {
   uint64_t P3			:1;	// parity
 };
 
-struct {
-	unsigned char parity_flag	:1;
-	unsigned char parity_min	:1;
-	unsigned char parity_hour	:1;
-	unsigned char parity_date	:1;
-} flags;
-
 /**
  * Interrupthandler for signal pin
  */
@@ -97,48 +101,122 @@ void DCF77Base::dcf77frame2time(DCF77tm &time, const uint64_t& dcf77frame) {
 	time.tm_isdst = bits.Z1;
 }
 
-bool DCF77Base::concludeReceivedBits(uint64_t& dcf77frame) {
+int32_t DCF77Base::utcOffset(const uint64_t& dcf77frame) {
+	const DCF77bits& bits = reinterpret_cast<const DCF77bits&>(dcf77frame);
+	return bits.Z1 ? 2 * 3600L : 3600L;
+}
+
+bool DCF77Base::dstChangeAnnounced(const uint64_t& dcf77frame) {
+	return reinterpret_cast<const DCF77bits&>(dcf77frame).A1;
+}
+
+bool DCF77Base::leapSecondAnnounced(const uint64_t& dcf77frame) {
+	return reinterpret_cast<const DCF77bits&>(dcf77frame).A2;
+}
+
+DCF77Base::FRAME_STATE DCF77Base::concludeReceivedBits(uint64_t& dcf77frame) {
   bool successfullUpdate = mRxBitBufPos == 59;
-  dcf77frame = mRxBitBuffer;
+  if (mRxBitBufPos == 60) {
+    // 61 second minute: The leap second is transmitted as additional 0 bit.
+    successfullUpdate = leapSecondAnnounced(mRxBitBuffer) && (mRxBitBuffer >> 59) == 0;
+  }
+  dcf77frame = mRxBitBuffer & ((static_cast<uint64_t>(1) << 59) - 1);
 
   // reset buffer
   mRxBitBufPos = 0;
   mRxBitBuffer = 0;
 
-	if (successfullUpdate) {
-		successfullUpdate = flags.parity_min == reinterpret_cast<struct DCF77bits&>(dcf77frame).P1
-				&& flags.parity_hour == reinterpret_cast<struct DCF77bits&>(dcf77frame).P2
-				&& flags.parity_date == reinterpret_cast<struct DCF77bits&>(dcf77frame).P3;
+	if (not successfullUpdate) {
+		return FRAME_INCOMPLETE;
+	}
+
+	successfullUpdate = mFlags.parity_min == reinterpret_cast<struct DCF77bits&>(dcf77frame).P1
+			&& mFlags.parity_hour == reinterpret_cast<struct DCF77bits&>(dcf77frame).P2
+			&& mFlags.parity_date == reinterpret_cast<struct DCF77bits&>(dcf77frame).P3;
+
+	return successfullUpdate ? FRAME_VALID : FRAME_PARITY_ERROR;
+}
+
+void DCF77Base::pushEvent(const DCF77event::TYPE type, const uint32_t systick,
+    const uint64_t dcf77frame) {
+#if DCF77_EVENT_QUEUE_SIZE > 0
+	const uint8_t head = mEventHead;
+	const uint8_t next = (head + 1) % DCF77_EVENT_QUEUE_SIZE;
+	if (next == mEventTail) {
+		return; // mailbox full
+	}
+	DCF77event& event = mEvents[head];
+	event.mFrame = dcf77frame;
+	event.mSystick = systick;
+	event.mType = type;
+	event.mSecond = mFlags.minute_known ? mRxBitBufPos
+	    : static_cast<uint8_t>(DCF77event::SECOND_UNKNOWN);
+	DCF77_COMPILER_BARRIER();
+	mEventHead = next;
+#else
+	// Mailbox removed.
+	(void)type;
+	(void)systick;
+	(void)dcf77frame;
+#endif
+}
+
+#if DCF77_EVENT_QUEUE_SIZE > 0
+bool DCF77Base::poll(DCF77event& event) {
+	const uint8_t tail = mEventTail;
+	if (tail != mEventHead) {
+		DCF77_COMPILER_BARRIER();
+		event = mEvents[tail];
+		DCF77_COMPILER_BARRIER();
+		mEventTail = (tail + 1) % DCF77_EVENT_QUEUE_SIZE;
+		return true;
 	}
 
-	return successfullUpdate;
+	// The loss of the signal is measured from the last falling edge
+	// seen by the interrupt handler, as the mailbox may have dropped
+	// events while loop() has not been polling.
+	const uint32_t systick = millis();
+	noInterrupts();
+	const bool isSignalLost = systick - mPreviousPulseTime >= DCF_SIGNAL_LOST_MILLIS;
+	const bool isReported = isSignalLost && not mFlags.signal_lost;
+	mFlags.signal_lost = isSignalLost;
+	interrupts();
+	if (isReported) {
+		event.mFrame = 0;
+		event.mSystick = systick;
+		event.mType = DCF77event::SIGNAL_LOST;
+		event.mSecond = DCF77event::SECOND_UNKNOWN;
+		return true;
+	}
+	return false;
 }
+#endif
 
 void DCF77Base::appendReceivedBit(const unsigned signalBit) {
-	if (mRxBitBufPos < 59) {
+	if (mRxBitBufPos < 60) {
 		mRxBitBuffer = mRxBitBuffer | static_cast<uint64_t>(signalBit) << mRxBitBufPos;
 
 		// Update the parity bits. First: Reset when minute, hour or date starts.
 		if (mRxBitBufPos == 21 || mRxBitBufPos == 29 || mRxBitBufPos == 36) {
-			flags.parity_flag = 0;
+			mFlags.parity_flag = 0;
 		}
 
 		// Save the parity when the corresponding segment ends
 		if (mRxBitBufPos == 28) {
-			flags.parity_min = flags.parity_flag;
+			mFlags.parity_min = mFlags.parity_flag;
 		};
 
 		if (mRxBitBufPos == 35) {
-			flags.parity_hour = flags.parity_flag;
+			mFlags.parity_hour = mFlags.parity_flag;
 		};
 
 		if (mRxBitBufPos == 58) {
-			flags.parity_date = flags.parity_flag;
+			mFlags.parity_date = mFlags.parity_flag;
 		};
 
 		// When we received a 1, toggle the parity flag
 		if (signalBit == 1) {
-			flags.parity_flag = flags.parity_flag ^ 1;
+			mFlags.parity_flag = mFlags.parity_flag ^ 1;
 		}
 
 		mRxBitBufPos++;
@@ -147,30 +225,48 @@ void DCF77Base::appendReceivedBit(const unsigned signalBit) {
 
 void DCF77Base::processPulse(const DCF77pulse &dcf77signal) {
   if (dcf77signal.mPulseLevel == DCF_SIGNAL_STATE_LOW) {
-    if (mPreviousPulse.mPulseLevel != DCF_SIGNAL_STATE_LOW) {
+    if (mFlags.pulse_level != DCF_SIGNAL_STATE_LOW) {
       /* falling edge */
-      if ((dcf77signal.mPulseTime - mPreviousPulse.mPulseTime) > DCF_SYNC_MILLIS) {
+      if ((dcf77signal.mPulseTime - mPreviousPulseTime) > DCF_SYNC_MILLIS) {
         uint64_t dcf77frame;
-        if (concludeReceivedBits(dcf77frame)) {
+        const FRAME_STATE frameState = concludeReceivedBits(dcf77frame);
+        // Only a valid frame proves that the gap has been the minute
+        // mark rather than a missing pulse.
+        mFlags.minute_known = frameState == FRAME_VALID;
+        if (frameState == FRAME_VALID) {
+          pushEvent(DCF77event::MINUTE_FRAME, dcf77signal.mPulseTime, dcf77frame);
+#if DCF77_FRAME_CALLBACK
           onDCF77FrameReceived(dcf77frame, dcf77signal.mPulseTime);
+#endif
+        } else if (frameState == FRAME_PARITY_ERROR) {
+          pushEvent(DCF77event::PARITY_FAILURE, dcf77signal.mPulseTime);
         }
       }
-      mPreviousPulse = dcf77signal;
+      pushEvent(DCF77event::SECOND_TICK, dcf77signal.mPulseTime);
+      mPreviousPulseTime = dcf77signal.mPulseTime;
+      mFlags.pulse_level = DCF_SIGNAL_STATE_LOW;
     }
   } else {
-    if (mPreviousPulse.mPulseLevel != DCF_SIGNAL_STATE_HIGH) {
+    if (mFlags.pulse_level != DCF_SIGNAL_STATE_HIGH) {
       /* rising edge */
-      const uint32_t difference = dcf77signal.mPulseTime - mPreviousPulse.mPulseTime;
+      const uint32_t difference = dcf77signal.mPulseTime - mPreviousPulseTime;
       const unsigned bit = difference < DCF_SPLIT_MILLIS ? 0 : 1;
       appendReceivedBit(bit);
-      mPreviousPulse.mPulseLevel = dcf77signal.mPulseLevel;
+      mFlags.pulse_level = DCF_SIGNAL_STATE_HIGH;
     }
   }
 }
 
+#if DCF77_FRAME_CALLBACK
+void DCF77Base::onDCF77FrameReceived(const uint64_t /*dcf77frame*/,
+    const uint32_t /*systick*/) {
+}
+#endif
+
 void DCF77Base::begin(int pin, void (*intHandler)()) {
+	mPreviousPulseTime = millis();
 	pinMode(pin, INPUT_PULLUP);
-	mPreviousPulse.mPulseLevel = digitalRead(pin);
+	mFlags.pulse_level = digitalRead(pin) != DCF_SIGNAL_STATE_LOW;
 	attachInterrupt(digitalPinToInterrupt(pin), intHandler, CHANGE);
 }
 
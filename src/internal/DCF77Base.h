@@ -31,6 +31,25 @@
 #include "DCF77tm.h"
 #include "ISR_ATTR.h"
 
+/**
+ * Number of entries of the event mailbox. One entry is
+ * kept free to distinguish a full from an empty mailbox.
+ * Set to 0 to remove the mailbox and poll() in order to
+ * save RAM and flash.
+ */
+#ifndef DCF77_EVENT_QUEUE_SIZE
+#define DCF77_EVENT_QUEUE_SIZE 4
+#endif
+
+/**
+ * Set to false to remove the virtual callback function
+ * onDCF77FrameReceived(). Frames are then obtained by poll()
+ * only, and the receiver does not carry a vtable pointer.
+ */
+#ifndef DCF77_FRAME_CALLBACK
+#define DCF77_FRAME_CALLBACK true
+#endif
+
 /**
  * This base class does the main work to receive and
  * decode Dcf77 frames. The derived template class
@@ -38,6 +57,31 @@
  */
 class DCF77Base {
 public:
+  /**
+   * An event obtained by poll().
+   */
+  struct DCF77event {
+    enum TYPE : uint8_t {
+      SECOND_TICK,    // A second has started. mSecond holds the second within the minute or SECOND_UNKNOWN.
+      MINUTE_FRAME,   // A valid frame has been received. mFrame holds the frame.
+      PARITY_FAILURE, // A complete frame has been received, but with parity error.
+      SIGNAL_LOST,    // No pulse has been received for a while.
+    };
+    /* mSecond of a SECOND_TICK, while the minute mark is not known. */
+    enum : uint8_t {SECOND_UNKNOWN = 0xFF};
+    uint64_t mFrame;
+    /* The system tick in unit of milliseconds at which the event occurred. */
+    uint32_t mSystick;
+    TYPE mType;
+    /* The second within the minute, counted from the minute mark at
+     * which the last valid frame has been received. SECOND_UNKNOWN
+     * before the first valid frame, and from a minute mark or a
+     * missing pulse that did not complete a valid frame until the
+     * next valid frame. A spurious pulse within a minute advances
+     * the count until the next minute mark. */
+    uint8_t mSecond;
+  };
+
   /**
    * To be called by the interrupt handler.
    *
@@ -55,18 +99,68 @@ public:
    */
 	static void dcf77frame2time(DCF77tm &time, const uint64_t& dcf77frame);
 
+  /**
+   * @return The offset of the local time in the dcf77 frame from
+   *  UTC in unit of seconds. That is 7200 during CEST and 3600
+   *  during CET.
+   */
+  static int32_t utcOffset(const uint64_t& dcf77frame);
+
+  /**
+   * @return true, if the dcf77 frame announces a change between
+   *  CET and CEST at the end of the current hour (bit A1).
+   */
+  static bool dstChangeAnnounced(const uint64_t& dcf77frame);
+
+  /**
+   * @return true, if the dcf77 frame announces a leap second
+   *  at the end of the current hour (bit A2).
+   */
+  static bool leapSecondAnnounced(const uint64_t& dcf77frame);
+
+  /**
+   * Fetch the oldest pending event. Events are queued from within
+   * the interrupt context without locking and are to be fetched
+   * frequently from loop(). Events that occur while the mailbox is
+   * full are dropped.
+   *
+   * Usage:
+   *
+   * DCF77Base::DCF77event event;
+   * while(myReceiver.poll(event)) {
+   *   switch(event.mType) {
+   *     ...
+   *   }
+   * }
+   *
+   * @param[out] event The fetched event.
+   *
+   * @return true, if an event has been fetched. Otherwise false.
+   */
+#if DCF77_EVENT_QUEUE_SIZE > 0
+  bool poll(DCF77event& event);
+#endif
+
 protected:
-	struct DCF77pulse {uint32_t mPulseTime = 0; int mPulseLevel = 1;};
+	struct DCF77pulse {uint32_t mPulseTime = 0; uint8_t mPulseLevel = 1;};
 
 	/**
 	 * Establish interrupt handler for pin.
 	 */
 	void begin(int pin, void (*intHandler)());
 
-private:
-	TEXT_ISR_ATTR_2_INLINE
+	/**
+	 * Decode a level change of the receiver signal. Called by
+	 * onPinInterrupt(). Derived classes may call it directly to
+	 * decode recorded pulses. The decoding state is kept per
+	 * instance, so independent instances may decode concurrently.
+	 */
+	TEXT_ISR_ATTR_2
 	void processPulse(const DCF77pulse &dcf77signal);
 
+private:
+	enum FRAME_STATE : uint8_t {FRAME_VALID, FRAME_INCOMPLETE, FRAME_PARITY_ERROR};
+
 	/**
 	 * Append a received bit to the rx buffer.
 	 */
@@ -76,31 +170,77 @@ private:
 	/**
 	 * Obtain a valid dcf77 frame.
 	 * Check whether the receive buffer contains is a completed
-	 * valid frame, and reset the receive buffer.
+	 * valid frame, and reset the receive buffer. A minute with
+	 * an inserted leap second carries an additional 0 bit, which
+	 * is accepted when the frame announces the leap second.
 	 *
 	 * @param[out] dcf77frame. The received dcf77 frame, if
 	 *  the receive buffer contained a valid one.
 	 *
-	 * @ return true, if the receive buffer contained a valid
-	 *  frame. Otherwise false.
+	 * @ return FRAME_VALID, if the receive buffer contained a valid
+	 *  frame. FRAME_PARITY_ERROR, if it contained a complete frame
+	 *  with parity error. Otherwise FRAME_INCOMPLETE.
+	 */
+	TEXT_ISR_ATTR_3_INLINE
+	FRAME_STATE concludeReceivedBits(uint64_t& dcf77frame);
+
+	/**
+	 * Append an event to the mailbox. Drops the event, if the
+	 * mailbox is full.
 	 */
 	TEXT_ISR_ATTR_3_INLINE
-	bool concludeReceivedBits(uint64_t& dcf77frame);
+	void pushEvent(const DCF77event::TYPE type, const uint32_t systick,
+	    const uint64_t dcf77frame = 0);
 
+#if DCF77_FRAME_CALLBACK
 	/**
 	 * Callback function to be overridden by the derived class to
 	 * obtain a received dcf77 frame. Note that this function
 	 * runs within the interrupt context and must be executed
 	 * quickly in order not to prevent other lower priority
-	 * interrupts to be serviced.
+	 * interrupts to be serviced. Derived classes that obtain
+	 * frames by poll() need not override it.
 	 */
 	TEXT_ISR_ATTR_4
 	virtual void onDCF77FrameReceived(const uint64_t dcf77frame,
-	    const uint32_t systick) = 0;
+	    const uint32_t systick);
+#endif
 
+  /* The members are ordered by decreasing alignment to avoid
+   * padding. */
   uint64_t mRxBitBuffer = 0;
-  size_t mRxBitBufPos = 0;
-  DCF77pulse mPreviousPulse;
+  /* The time of the last falling edge. */
+  uint32_t mPreviousPulseTime = 0;
+  uint8_t mRxBitBufPos = 0;
+
+  struct {
+    /* Parity of the frame being received. */
+    unsigned char parity_flag :1;
+    unsigned char parity_min  :1;
+    unsigned char parity_hour :1;
+    unsigned char parity_date :1;
+    /* Set at the minute mark of a valid frame, cleared at any other
+     * gap in the pulses. */
+    unsigned char minute_known :1;
+    /* The level of the previous pulse. */
+    unsigned char pulse_level :1;
+    /* Set by poll() when it has reported the loss of the signal.
+     * Modified with interrupts disabled, since the interrupt
+     * context modifies the other bits. */
+    unsigned char signal_lost :1;
+  } mFlags = {0, 0, 0, 0, 0, 1, 0};
+
+#if DCF77_EVENT_QUEUE_SIZE > 0
+  /* Event mailbox. mEventHead is written by the interrupt
+   * context only, mEventTail by poll() only. */
+  volatile uint8_t mEventHead = 0;
+  volatile uint8_t mEventTail = 0;
+  DCF77event mEvents[DCF77_EVENT_QUEUE_SIZE];
+#endif
 };
 
+static_assert(DCF77_EVENT_QUEUE_SIZE == 0
+    || (DCF77_EVENT_QUEUE_SIZE >= 2 && DCF77_EVENT_QUEUE_SIZE <= 256),
+    "DCF77_EVENT_QUEUE_SIZE must be 0 or within 2..256.");
+
 #endif /* DCF77_INTERNAL_DCF77_BASE_HPP_ */
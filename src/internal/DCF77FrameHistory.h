@@ -0,0 +1,251 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_INTERNAL_DCF77FRAMEHISTORY_HPP_
+#define DCF77_INTERNAL_DCF77FRAMEHISTORY_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "DCF77Base.h"
+#include "DCF77SoftClock.h"
+#include "DCF77tm.h"
+#include "ISR_ATTR.h"
+#include <Arduino.h>
+
+/**
+ * A fixed size ring of the last HISTORY_SIZE received dcf77 frames
+ * along with the system tick time stamp at which each frame was
+ * received. Each entry serves as an anchor that allows to convert
+ * a system tick time stamp from the past into an absolute time.
+ *
+ * Usage:
+ *
+ * class MyDcf77Receiver : public DCF77RX<DCF77_PIN> {
+ *   void onDCF77FrameReceived(const uint64_t dcf77frame, const uint32_t systick) override {
+ *     mHistory.push(dcf77frame, systick);
+ *   }
+ * public:
+ *   DCF77FrameHistory<8> mHistory;
+ * };
+ *
+ * // Later on, when the time of an event that has been recorded
+ * // with millis() is needed:
+ * DCF77time_t time;
+ * unsigned millisec;
+ * if(myReceiver.mHistory.systickToUtc(eventSystick, time, &millisec)) {
+ *   ...
+ * }
+ *
+ * A system tick is resolved with the most recent anchor that has
+ * been received at or before that system tick. Hence time jumps
+ * between the anchors (e.g. daylight savings changes) are reflected
+ * correctly. The system tick may also be younger than the most
+ * recent anchor. In that case the time is extrapolated from the
+ * most recent anchor. Changes announced by the anchor are applied
+ * when extrapolating beyond the end of its hour, as by
+ * DCF77SoftClock.
+ *
+ * The local time repeats an hour when CEST changes to CET. Use
+ * systickToUtc() or the isdst output of systickToTime() to tell
+ * the two apart.
+ *
+ * The history window must not span more than 2**31 milliseconds
+ * (approximately 24 days). Within that window, overruns of millis()
+ * are handled correctly.
+ */
+template<size_t HISTORY_SIZE> class DCF77FrameHistory {
+  static_assert(HISTORY_SIZE > 0, "HISTORY_SIZE must not be 0.");
+
+public:
+  DCF77FrameHistory() : mNext(0), mCount(0), mPushes(0) {
+  }
+
+  /**
+   * Store a received frame as the most recent anchor. The oldest
+   * anchor is dropped, if the history is full. To be called from
+   * onDCF77FrameReceived().
+   *
+   * @param[in] dcf77frame The received dcf77 frame.
+   * @param[in] systick The system tick at which the frame has been
+   *  received.
+   */
+  TEXT_ISR_ATTR_4_INLINE
+  void push(const uint64_t dcf77frame, const uint32_t systick) {
+    Anchor& anchor = mAnchors[mNext];
+    anchor.mFrame = dcf77frame;
+    anchor.mSystick = systick;
+    mNext = (mNext + 1) % HISTORY_SIZE;
+    if(mCount < HISTORY_SIZE) {
+      mCount++;
+    }
+    mPushes = mPushes + 1;
+  }
+
+  /**
+   * @return The number of anchors currently stored.
+   */
+  size_t size() const {
+    noInterrupts();
+    const size_t result = mCount;
+    interrupts();
+    return result;
+  }
+
+  /**
+   * Convert a system tick time stamp to the local time (CET or
+   * CEST). Not to be called from interrupt context.
+   *
+   * @param[in] systick The system tick time stamp in unit of
+   *  milliseconds as obtained from millis().
+   * @param[out] time The local time in seconds since 1 Jan 0:00:00
+   *  1970 at the given system tick.
+   * @param[out] millisec The number of expired milliseconds
+   *  within the second. May be nullptr.
+   * @param[out] isdst Set to 1, if CEST is in effect at the given
+   *  system tick. Otherwise 0. May be nullptr.
+   *
+   * @return false, if the system tick is older than the oldest
+   *  anchor or if no anchor is available yet. Otherwise true.
+   */
+  bool systickToTime(const uint32_t systick, DCF77time_t& time,
+      unsigned* millisec, int* isdst = nullptr) const {
+    DCF77SoftClock clock;
+    return anchorClock(systick, clock)
+        && clock.localAt(systick, time, millisec, isdst);
+  }
+
+  /**
+   * Convert a system tick time stamp to the UTC time. Not to be
+   * called from interrupt context.
+   *
+   * @param[in] systick The system tick time stamp in unit of
+   *  milliseconds as obtained from millis().
+   * @param[out] time The UTC time in seconds since 1 Jan 0:00:00
+   *  1970 at the given system tick.
+   * @param[out] millisec The number of expired milliseconds
+   *  within the second. May be nullptr.
+   *
+   * @return false, if the system tick is older than the oldest
+   *  anchor or if no anchor is available yet. Otherwise true.
+   */
+  bool systickToUtc(const uint32_t systick, DCF77time_t& time,
+      unsigned* millisec) const {
+    DCF77SoftClock clock;
+    return anchorClock(systick, clock)
+        && clock.utcAt(systick, time, millisec);
+  }
+
+private:
+  struct Anchor {uint64_t mFrame; uint32_t mSystick;};
+
+  /**
+   * Set clock to the anchor that resolves systick.
+   *
+   * @return false, if there is no such anchor.
+   */
+  bool anchorClock(const uint32_t systick, DCF77SoftClock& clock) const {
+    // Interrupts are disabled only to take a snapshot of the ring
+    // state. The anchors are searched with interrupts enabled, and
+    // the search is repeated if push() has run in the meantime.
+    Anchor anchor;
+    bool found;
+    bool pushed;
+    do {
+      noInterrupts();
+      const uint8_t pushes = mPushes;
+      const size_t next = mNext;
+      const size_t count = mCount;
+      interrupts();
+
+      found = findAnchor(systick, next, count, anchor);
+
+      noInterrupts();
+      pushed = pushes != mPushes;
+      interrupts();
+    } while(pushed);
+
+    if(not found) {
+      return false;
+    }
+    clock.set(anchor.mFrame, anchor.mSystick);
+    return true;
+  }
+
+  /**
+   * @return The anchor at position pos, where position 0 is the
+   *  oldest and position count-1 the most recent anchor.
+   */
+  const Anchor& at(const size_t pos, const size_t next, const size_t count) const {
+    return mAnchors[(next + HISTORY_SIZE - count + pos) % HISTORY_SIZE];
+  }
+
+  /**
+   * Find the youngest anchor that has been received at or before
+   * systick. If systick is younger than all anchors, that is the
+   * most recent one.
+   */
+  bool findAnchor(const uint32_t systick, const size_t next,
+      const size_t count, Anchor& anchor) const {
+    if(count == 0) {
+      return false;
+    }
+
+    // All ages are measured backwards from the most recent anchor,
+    // which makes them monotonic regardless of millis() overruns.
+    const uint32_t newestSystick = at(count - 1, next, count).mSystick;
+    size_t pos = count - 1;
+    if(static_cast<int32_t>(systick - newestSystick) < 0) {
+      const uint32_t age = newestSystick - systick;
+      if(newestSystick - at(0, next, count).mSystick < age) {
+        return false; // Older than the oldest anchor.
+      }
+      // Binary search for the youngest anchor that is at least
+      // as old as the system tick.
+      size_t lo = 0;
+      size_t hi = count - 1;
+      while(lo < hi) {
+        const size_t mid = lo + (hi - lo + 1) / 2;
+        if(newestSystick - at(mid, next, count).mSystick >= age) {
+          lo = mid;
+        } else {
+          hi = mid - 1;
+        }
+      }
+      pos = lo;
+    }
+
+    anchor = at(pos, next, count);
+    return true;
+  }
+
+  Anchor mAnchors[HISTORY_SIZE];
+  size_t mNext;
+  size_t mCount;
+  /* Incremented by push(), to detect a push() during a search. */
+  volatile uint8_t mPushes;
+};
+
+#endif /* DCF77_INTERNAL_DCF77FRAMEHISTORY_HPP_ */
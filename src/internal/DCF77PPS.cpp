@@ -0,0 +1,256 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "DCF77PPS.h"
+#include "DCF77Base.h"
+#include <Arduino.h>
+
+namespace {
+
+/* Nominal length of a second in 1/256 micros(). */
+constexpr uint32_t NOMINAL_PERIOD = 1000000UL << 8;
+/* Maximum deviation of the length of a second from nominal: 1000 ppm */
+constexpr int32_t MAX_PERIOD_DEVIATION = 1000L << 8;
+/* Edges that deviate more from the prediction are ignored. */
+constexpr int32_t EDGE_WINDOW_MICROS = 100000L;
+/* Edges within the window correct the prediction by at most this
+ * deviation, to limit the impact of glitches close to the edge. */
+constexpr int32_t EDGE_CLAMP_MICROS = 10000L;
+/* Resynchronize after this number of consecutively ignored edges. */
+constexpr uint8_t MAX_REJECTED_EDGES = 10;
+/* Loop filter: a phase error e corrects the phase by e / PHASE_GAIN_DIV
+ * and the length of a second by e / PHASE_GAIN_DIV**2. A wide loop
+ * is used to acquire the length of a second, then a narrow one to
+ * filter the jitter of the edges. */
+constexpr int32_t PHASE_GAIN_DIV_ACQUIRE = 16;
+constexpr int32_t PHASE_GAIN_DIV_TRACK = 64;
+/* Number of accepted edges before switching to the narrow loop. */
+constexpr uint8_t ACQUIRE_EDGES = 120;
+/* The minute mark is the missing pulse of second 59, so the gap
+ * before it is about 2 seconds. */
+constexpr uint32_t MINUTE_GAP_MIN_MILLIS = 1800;
+constexpr uint32_t MINUTE_GAP_MAX_MILLIS = 2200;
+
+constexpr uint8_t SECOND_UNKNOWN = 0xFF;
+constexpr uint8_t SECONDS_PER_MINUTE = 60;
+/* A leap second is inserted at the end of this minute of the hour. */
+constexpr int LEAP_SECOND_MINUTE = 59;
+constexpr uint8_t LEAP_SECOND_NONE = 0xFF;
+
+} // anonymous namespace
+
+DCF77PPS::DCF77PPS(int ppsPin, int minutePin, uint32_t pulseWidthMicros)
+  : mPpsPin(ppsPin), mMinutePin(minutePin), mPulseWidth(pulseWidthMicros),
+    mNext(0), mNextFraction(0), mPeriod(NOMINAL_PERIOD),
+    mNextSecond(SECOND_UNKNOWN), mSecondsInMinute(SECONDS_PER_MINUTE),
+    mMinutesToLeapSecond(LEAP_SECOND_NONE),
+    mPulseStart(0), mPulseActive(false), mRejectedEdges(0), mAcceptedEdges(0),
+    mPreviousTick(0), mMinuteFrameReceived(false),
+    mFrameMinutesToLeapSecond(LEAP_SECOND_NONE), mState(UNSYNCHRONIZED) {
+}
+
+void DCF77PPS::begin() {
+  pinMode(mPpsPin, OUTPUT);
+  digitalWrite(mPpsPin, LOW);
+  if(mMinutePin >= 0) {
+    pinMode(mMinutePin, OUTPUT);
+    digitalWrite(mMinutePin, LOW);
+  }
+}
+
+void DCF77PPS::advance() {
+  const uint32_t next = mNextFraction + mPeriod;
+  mNext = mNext + (next >> 8);
+  mNextFraction = next & 0xFF;
+  if(mNextSecond != SECOND_UNKNOWN) {
+    const uint8_t second = mNextSecond + 1;
+    if(second < mSecondsInMinute) {
+      mNextSecond = second;
+    } else {
+      mNextSecond = 0;
+      mSecondsInMinute = SECONDS_PER_MINUTE;
+      if(mMinutesToLeapSecond != LEAP_SECOND_NONE && --mMinutesToLeapSecond == 0) {
+        mSecondsInMinute = SECONDS_PER_MINUTE + 1;
+        mMinutesToLeapSecond = LEAP_SECOND_NONE;
+      }
+    }
+  }
+}
+
+void DCF77PPS::resynchronize(const uint32_t time, const bool isMinuteMark) {
+  mNext = time;
+  mNextFraction = 0;
+  mNextSecond = isMinuteMark ? 0 : SECOND_UNKNOWN;
+  mSecondsInMinute = SECONDS_PER_MINUTE;
+  mMinutesToLeapSecond = LEAP_SECOND_NONE;
+  mRejectedEdges = 0;
+  mAcceptedEdges = 0;
+  mState = TRACKING;
+  // The edge itself is too late for a pulse. Start with the next second.
+  advance();
+}
+
+void DCF77PPS::applyLeapSecondAnnouncement() {
+  if(mFrameMinutesToLeapSecond == 0) {
+    // advance() restores 60 seconds when this minute has expired.
+    mSecondsInMinute = SECONDS_PER_MINUTE + 1;
+    mMinutesToLeapSecond = LEAP_SECOND_NONE;
+  } else if(mFrameMinutesToLeapSecond != LEAP_SECOND_NONE) {
+    mMinutesToLeapSecond = mFrameMinutesToLeapSecond;
+  }
+}
+
+void DCF77PPS::onSecondTick(const uint32_t systick, const uint8_t second) {
+  // The edge happened somewhere within the millisecond of systick.
+  const uint32_t time = systick * 1000UL + 500;
+  // A gap in the pulses is only the minute mark, if it has completed
+  // a valid frame and lasted about 2 seconds. A missing pulse must not
+  // reset the minute phase, even if a glitch has compensated for it.
+  const uint32_t gap = systick - mPreviousTick;
+  const bool isMinuteMark = second == 0 && mMinuteFrameReceived
+      && gap >= MINUTE_GAP_MIN_MILLIS && gap <= MINUTE_GAP_MAX_MILLIS;
+  mMinuteFrameReceived = false;
+  mPreviousTick = systick;
+
+  // Disable interrupts to avoid race condition with service().
+  noInterrupts();
+  if(mState == UNSYNCHRONIZED) {
+    resynchronize(time, isMinuteMark);
+    if(isMinuteMark) {
+      applyLeapSecondAnnouncement();
+    }
+    interrupts();
+    return;
+  }
+
+  // Find the predicted second start nearest to the edge. service()
+  // may or may not have advanced beyond it yet.
+  const int32_t halfPeriod = mPeriod >> 9;
+  while(static_cast<int32_t>(time - mNext) > halfPeriod) {
+    advance();
+  }
+  int32_t error = time - mNext;
+  bool isPreviousSecond = false;
+  if(error < -halfPeriod) {
+    error += mPeriod >> 8;
+    isPreviousSecond = true;
+  }
+
+  if(error > EDGE_WINDOW_MICROS || error < -EDGE_WINDOW_MICROS) {
+    if(++mRejectedEdges >= MAX_REJECTED_EDGES) {
+      resynchronize(time, isMinuteMark);
+      if(isMinuteMark) {
+        applyLeapSecondAnnouncement();
+      }
+    }
+    interrupts();
+    return;
+  }
+  mRejectedEdges = 0;
+  if(error > EDGE_CLAMP_MICROS) {
+    error = EDGE_CLAMP_MICROS;
+  } else if(error < -EDGE_CLAMP_MICROS) {
+    error = -EDGE_CLAMP_MICROS;
+  }
+
+  int32_t phaseGainDiv = PHASE_GAIN_DIV_TRACK;
+  if(mAcceptedEdges < ACQUIRE_EDGES) {
+    mAcceptedEdges++;
+    phaseGainDiv = PHASE_GAIN_DIV_ACQUIRE;
+  }
+  mNext = mNext + error / phaseGainDiv;
+  // mPeriod is in 1/256 micros.
+  int32_t deviation = static_cast<int32_t>(mPeriod - NOMINAL_PERIOD)
+      + error * 256 / (phaseGainDiv * phaseGainDiv);
+  if(deviation > MAX_PERIOD_DEVIATION) {
+    deviation = MAX_PERIOD_DEVIATION;
+  } else if(deviation < -MAX_PERIOD_DEVIATION) {
+    deviation = -MAX_PERIOD_DEVIATION;
+  }
+  mPeriod = NOMINAL_PERIOD + deviation;
+
+  if(isMinuteMark) {
+    mNextSecond = isPreviousSecond ? 1 : 0;
+    applyLeapSecondAnnouncement();
+  }
+  interrupts();
+}
+
+void DCF77PPS::onMinuteFrame(const uint64_t dcf77frame) {
+  // The SECOND_TICK of the same edge follows and applies the
+  // announcement, once it has been accepted as the minute mark.
+  mMinuteFrameReceived = true;
+  mFrameMinutesToLeapSecond = LEAP_SECOND_NONE;
+
+  if(not DCF77Base::leapSecondAnnounced(dcf77frame)) {
+    return;
+  }
+  // The frame describes the minute that has started with the minute
+  // mark at which the frame has been received. A2 is still set in the
+  // frame of minute 0, that follows the leap second.
+  DCF77tm time;
+  DCF77Base::dcf77frame2time(time, dcf77frame);
+  if(time.tm_min == 0 || time.tm_min > LEAP_SECOND_MINUTE) {
+    return;
+  }
+  mFrameMinutesToLeapSecond = LEAP_SECOND_MINUTE - time.tm_min;
+}
+
+void DCF77PPS::service(const uint32_t now) {
+  if(mPulseActive && now - mPulseStart >= mPulseWidth) {
+    digitalWrite(mPpsPin, LOW);
+    if(mMinutePin >= 0) {
+      digitalWrite(mMinutePin, LOW);
+    }
+    mPulseActive = false;
+  }
+
+  if(mState == TRACKING && static_cast<int32_t>(now - mNext) >= 0) {
+    digitalWrite(mPpsPin, HIGH);
+    if(mMinutePin >= 0 && mNextSecond == 0) {
+      digitalWrite(mMinutePin, HIGH);
+    }
+    mPulseStart = now;
+    mPulseActive = true;
+    // Skip seconds that have been missed, if service() was not called
+    // in time.
+    do {
+      advance();
+    } while(static_cast<int32_t>(now - mNext) >= 0);
+  }
+}
+
+uint32_t DCF77PPS::nextPulseMicros() const {
+  noInterrupts();
+  const uint32_t result = mNext;
+  interrupts();
+  return result;
+}
+
+uint32_t DCF77PPS::secondLengthMicros() const {
+  noInterrupts();
+  const uint32_t result = mPeriod >> 8;
+  interrupts();
+  return result;
+}
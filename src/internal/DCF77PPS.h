@@ -0,0 +1,199 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_INTERNAL_DCF77PPS_HPP_
+#define DCF77_INTERNAL_DCF77PPS_HPP_
+
+#include <stdint.h>
+#include "ISR_ATTR.h"
+
+/**
+ * Generates a second pulse (1PPS) and a minute pulse on GPIO pins,
+ * disciplined by the falling edges of the dcf77 signal.
+ *
+ * The start of each second is predicted from the edge time stamps by
+ * a phase locked loop that tracks both the phase and the length of a
+ * second in units of micros(). This filters the jitter of the receiver
+ * module and the millisecond resolution of the edge time stamps. Edges
+ * that deviate too much from the prediction are ignored, and the
+ * output keeps running on the predicted second length when edges are
+ * missing.
+ *
+ * Usage:
+ *
+ * DCF77RX<DCF77_PIN> myReceiver;
+ * DCF77PPS pps(PPS_PIN, MINUTE_PIN);
+ *
+ * void setup() {
+ *   myReceiver.begin();
+ *   pps.begin();
+ *   // Start a hardware timer that calls pps.service(micros())
+ *   // periodically, e.g. every 100 microseconds.
+ * }
+ *
+ * void loop() {
+ *   DCF77Base::DCF77event event;
+ *   while(myReceiver.poll(event)) {
+ *     if(event.mType == DCF77Base::DCF77event::MINUTE_FRAME) {
+ *       pps.onMinuteFrame(event.mFrame);
+ *     } else if(event.mType == DCF77Base::DCF77event::SECOND_TICK) {
+ *       pps.onSecondTick(event.mSystick, event.mSecond);
+ *     }
+ *   }
+ * }
+ *
+ * The resolution of the output is given by the period at which
+ * service() is called. Alternatively, loop() can arm a one shot
+ * timer for nextPulseMicros(). The example DCF77PPS calls service()
+ * from the Timer1 interrupt on AVR.
+ */
+class DCF77PPS {
+public:
+  /**
+   * @param[in] ppsPin The pin for the second pulse.
+   * @param[in] minutePin The pin for the minute pulse, or -1 for none.
+   * @param[in] pulseWidthMicros The duration of a pulse.
+   */
+  DCF77PPS(int ppsPin, int minutePin = -1, uint32_t pulseWidthMicros = 100000UL);
+
+  /**
+   * Configure the output pins. To be called once during setup().
+   */
+  void begin();
+
+  /**
+   * Feed the time stamp of a falling edge, that is the start of a
+   * second. To be called with the SECOND_TICK events obtained by
+   * DCF77Base::poll(). Not to be called from interrupt context.
+   *
+   * The minute phase is only taken from the minute mark of a valid
+   * frame, that is from second 0 right after a frame has been fed by
+   * onMinuteFrame(), about 2 seconds after the previous tick.
+   * Otherwise, the output keeps counting the seconds within the
+   * minute, also through missing pulses.
+   *
+   * @param[in] systick The system tick of the edge in unit of
+   *  milliseconds.
+   * @param[in] second The second within the minute, or
+   *  DCF77Base::DCF77event::SECOND_UNKNOWN.
+   */
+  void onSecondTick(const uint32_t systick, const uint8_t second);
+
+  /**
+   * Feed a received frame. Marks the following SECOND_TICK as the
+   * minute mark. Bit A2 announces a leap second at the end
+   * of the hour. The frames of that hour extend the minute 59 to 61
+   * seconds, which is the minute currently being counted, if the
+   * frame describes minute 59. Any frame received during the hour is
+   * sufficient. To be called with the MINUTE_FRAME events obtained by
+   * DCF77Base::poll(). Not to be called from interrupt context.
+   *
+   * @param[in] dcf77frame The received dcf77 frame.
+   */
+  void onMinuteFrame(const uint64_t dcf77frame);
+
+  /**
+   * Drive the output pins. To be called periodically from a timer
+   * interrupt or from loop().
+   *
+   * @param[in] now The actual time as obtained from micros().
+   */
+  TEXT_ISR_ATTR_1
+  void service(const uint32_t now);
+
+  /**
+   * Not to be called from interrupt context, since it enables
+   * interrupts on return.
+   *
+   * @return The micros() time stamp of the next second pulse.
+   */
+  uint32_t nextPulseMicros() const;
+
+  /**
+   * Not to be called from interrupt context, since it enables
+   * interrupts on return.
+   *
+   * @return The currently estimated length of a second in unit
+   *  of micros().
+   */
+  uint32_t secondLengthMicros() const;
+
+  /**
+   * @return true, as soon as the first edge has been received.
+   */
+  bool isSynchronized() const {
+    return mState != UNSYNCHRONIZED;
+  }
+
+private:
+  enum STATE : uint8_t {UNSYNCHRONIZED, TRACKING};
+
+  /* Advance mNext by one second. */
+  TEXT_ISR_ATTR_2_INLINE
+  void advance();
+
+  /* Restart the prediction at the edge received at time. */
+  void resynchronize(const uint32_t time, const bool isMinuteMark);
+
+  /* Set the length of the minutes from mFrameMinutesToLeapSecond. To
+   * be called when the minute mark of the frame has been accepted. */
+  void applyLeapSecondAnnouncement();
+
+  const int mPpsPin;
+  const int mMinutePin;
+  const uint32_t mPulseWidth;
+
+  /* Predicted start of the next second in micros(), with 8
+   * fractional bits in mNextFraction. */
+  volatile uint32_t mNext;
+  volatile uint8_t mNextFraction;
+  /* Length of a second in 1/256 micros(). */
+  volatile uint32_t mPeriod;
+  /* The second within the minute that starts at mNext, or
+   * SECOND_UNKNOWN. */
+  volatile uint8_t mNextSecond;
+  /* 61 in a minute with leap second. Otherwise 60. */
+  volatile uint8_t mSecondsInMinute;
+  /* The number of minutes to start until the minute with leap
+   * second starts, or LEAP_SECOND_NONE. */
+  volatile uint8_t mMinutesToLeapSecond;
+
+  uint32_t mPulseStart;
+  bool mPulseActive;
+  uint8_t mRejectedEdges;
+  uint8_t mAcceptedEdges;
+  /* The systick of the previous SECOND_TICK. */
+  uint32_t mPreviousTick;
+  /* Set by onMinuteFrame(), consumed by the next onSecondTick(). */
+  bool mMinuteFrameReceived;
+  /* The number of minutes to start until the minute with leap second
+   * starts as announced by the frame fed by onMinuteFrame(), or
+   * LEAP_SECOND_NONE. */
+  uint8_t mFrameMinutesToLeapSecond;
+  volatile STATE mState;
+};
+
+#endif /* DCF77_INTERNAL_DCF77PPS_HPP_ */
@@ -0,0 +1,131 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "DCF77SoftClock.h"
+#include "DCF77Base.h"
+#include <Arduino.h>
+
+namespace {
+
+constexpr int32_t SECSPERHOUR = 3600L;
+constexpr uint32_t MSECSPERMIN = 60000UL;
+
+} // anonymous namespace
+
+DCF77SoftClock::DCF77SoftClock()
+  : mSystick(0), mTransitionMillis(UINT32_MAX), mUtc{0, 0}, mLocal{0, 0},
+    mIsdst{0, 0}, mValid(false) {
+}
+
+void DCF77SoftClock::set(const uint64_t dcf77frame, const uint32_t systick) {
+  DCF77tm tm;
+  DCF77Base::dcf77frame2time(tm, dcf77frame);
+  const DCF77time_t local = tm.toTimeStamp();
+  const DCF77time_t utc = local - DCF77Base::utcOffset(dcf77frame);
+
+  mSystick = systick;
+  mLocal[BEFORE_TRANSITION] = local;
+  mUtc[BEFORE_TRANSITION] = utc;
+  mIsdst[BEFORE_TRANSITION] = tm.tm_isdst;
+
+  // Announcements are sent during the hour before the change, which
+  // takes effect at the end of that hour. Whether the frame for minute 0
+  // already belongs to that hour is ambiguous, hence it is ignored. The
+  // frame for minute 1 will bring the announcement.
+  const bool dstChange = DCF77Base::dstChangeAnnounced(dcf77frame);
+  const bool leapSecond = DCF77Base::leapSecondAnnounced(dcf77frame);
+  if((dstChange || leapSecond) && tm.tm_min != 0) {
+    mTransitionMillis = (60 - tm.tm_min) * MSECSPERMIN;
+  } else {
+    mTransitionMillis = UINT32_MAX;
+  }
+
+  DCF77time_t localAfter = local;
+  DCF77time_t utcAfter = utc;
+  int8_t isdstAfter = tm.tm_isdst;
+  if(dstChange) {
+    localAfter += tm.tm_isdst ? -SECSPERHOUR : SECSPERHOUR;
+    isdstAfter = !tm.tm_isdst;
+  }
+  if(leapSecond) {
+    // Second 59 is repeated.
+    localAfter -= 1;
+    utcAfter -= 1;
+  }
+  mLocal[AFTER_TRANSITION] = localAfter;
+  mUtc[AFTER_TRANSITION] = utcAfter;
+  mIsdst[AFTER_TRANSITION] = isdstAfter;
+  mValid = true;
+}
+
+bool DCF77SoftClock::at(const DCF77time_t (&anchor)[2], const uint32_t systick,
+    DCF77time_t& time, unsigned* millisec, int* isdst) const {
+  if(not mValid) {
+    return false;
+  }
+  const uint32_t millisSinceFrame = systick - mSystick;
+  const PHASE phase = millisSinceFrame < mTransitionMillis ?
+      BEFORE_TRANSITION : AFTER_TRANSITION;
+  time = anchor[phase] + millisSinceFrame / 1000;
+  if(millisec != nullptr) {
+    *millisec = millisSinceFrame % 1000;
+  }
+  if(isdst != nullptr) {
+    *isdst = mIsdst[phase];
+  }
+  return true;
+}
+
+bool DCF77SoftClock::localNow(DCF77time_t& time, unsigned* millisec,
+    int* isdst) const {
+  // Disable interrupts to avoid race condition with set(). millis()
+  // is read within, so that it is not older than mSystick.
+  noInterrupts();
+  const bool valid = at(mLocal, millis(), time, millisec, isdst);
+  interrupts();
+  return valid;
+}
+
+bool DCF77SoftClock::utcNow(DCF77time_t& time, unsigned* millisec) const {
+  noInterrupts();
+  const bool valid = at(mUtc, millis(), time, millisec, nullptr);
+  interrupts();
+  return valid;
+}
+
+bool DCF77SoftClock::localAt(const uint32_t systick, DCF77time_t& time,
+    unsigned* millisec, int* isdst) const {
+  noInterrupts();
+  const bool valid = at(mLocal, systick, time, millisec, isdst);
+  interrupts();
+  return valid;
+}
+
+bool DCF77SoftClock::utcAt(const uint32_t systick, DCF77time_t& time,
+    unsigned* millisec) const {
+  noInterrupts();
+  const bool valid = at(mUtc, systick, time, millisec, nullptr);
+  interrupts();
+  return valid;
+}
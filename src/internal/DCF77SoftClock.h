@@ -0,0 +1,147 @@
+/*
+  DCF77RX - Arduino libary receiving and decoding DCF77 frames Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/Dcf77Receiver/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef DCF77_INTERNAL_DCF77SOFTCLOCK_HPP_
+#define DCF77_INTERNAL_DCF77SOFTCLOCK_HPP_
+
+#include <stdint.h>
+#include "DCF77tm.h"
+#include "ISR_ATTR.h"
+
+/**
+ * A software clock that is synchronized by received dcf77 frames
+ * and extrapolated via the system tick from millis() in between.
+ *
+ * Announced changes between CET and CEST (bit A1) and announced
+ * leap seconds (bit A2) are decoded when a frame is set. The point
+ * in time at which the change takes effect is calculated once per
+ * frame, so that reading the clock takes just a single comparison
+ * to apply the change.
+ *
+ * An inserted leap second is represented by repeating second 59,
+ * as std::time_t can not represent second 60.
+ *
+ * Usage:
+ *
+ * class MyDcf77Receiver : public DCF77RX<DCF77_PIN> {
+ *   void onDCF77FrameReceived(const uint64_t dcf77frame, const uint32_t systick) override {
+ *     mClock.set(dcf77frame, systick);
+ *   }
+ * public:
+ *   DCF77SoftClock mClock;
+ * };
+ *
+ * The clock needs a frame update at least every 2**32 milliseconds,
+ * which is approximately every 49 days.
+ */
+class DCF77SoftClock {
+public:
+  DCF77SoftClock();
+
+  /**
+   * Synchronize the clock with a received frame. To be called
+   * from onDCF77FrameReceived().
+   *
+   * @param[in] dcf77frame The received dcf77 frame.
+   * @param[in] systick The system tick at which the frame has been
+   *  received.
+   */
+  TEXT_ISR_ATTR_4
+  void set(const uint64_t dcf77frame, const uint32_t systick);
+
+  /**
+   * Read the current local time (CET or CEST).
+   *
+   * @param[out] time The local time in seconds since 1 Jan 0:00:00
+   *  1970.
+   * @param[out] millisec The number of expired milliseconds within
+   *  the current second. May be nullptr.
+   * @param[out] isdst Set to 1, if CEST is in effect. Otherwise 0.
+   *  May be nullptr.
+   *
+   * @return false, as long as no dcf77 frame was set.
+   */
+  bool localNow(DCF77time_t& time, unsigned* millisec, int* isdst = nullptr) const;
+
+  /**
+   * Read the current UTC time.
+   *
+   * @param[out] time The UTC time in seconds since 1 Jan 0:00:00
+   *  1970.
+   * @param[out] millisec The number of expired milliseconds within
+   *  the current second. May be nullptr.
+   *
+   * @return false, as long as no dcf77 frame was set.
+   */
+  bool utcNow(DCF77time_t& time, unsigned* millisec) const;
+
+  /**
+   * Read the local time (CET or CEST) at a system tick, that is not
+   * older than the system tick of the last frame set.
+   *
+   * @param[in] systick The system tick time stamp in unit of
+   *  milliseconds as obtained from millis().
+   * @param[out] time, millisec, isdst See localNow().
+   *
+   * @return false, as long as no dcf77 frame was set.
+   */
+  bool localAt(const uint32_t systick, DCF77time_t& time,
+      unsigned* millisec, int* isdst = nullptr) const;
+
+  /**
+   * Read the UTC time at a system tick, that is not older than the
+   * system tick of the last frame set.
+   *
+   * @param[in] systick The system tick time stamp in unit of
+   *  milliseconds as obtained from millis().
+   * @param[out] time, millisec See utcNow().
+   *
+   * @return false, as long as no dcf77 frame was set.
+   */
+  bool utcAt(const uint32_t systick, DCF77time_t& time,
+      unsigned* millisec) const;
+
+private:
+  /* Index into the arrays below, before and after the transition. */
+  enum PHASE : uint8_t {BEFORE_TRANSITION, AFTER_TRANSITION};
+
+  /* To be called with interrupts disabled. */
+  bool at(const DCF77time_t (&anchor)[2], const uint32_t systick,
+      DCF77time_t& time, unsigned* millisec, int* isdst) const;
+
+  /* The system tick at which the last frame has been received. */
+  uint32_t mSystick;
+  /* Milliseconds after mSystick at which an announced change takes
+   * effect. UINT32_MAX if there is none. */
+  uint32_t mTransitionMillis;
+  /* UTC and local time at mSystick, without and with the change applied. */
+  DCF77time_t mUtc[2];
+  DCF77time_t mLocal[2];
+  int8_t mIsdst[2];
+  bool mValid;
+};
+
+#endif /* DCF77_INTERNAL_DCF77SOFTCLOCK_HPP_ */
@@ -27,6 +27,21 @@
 
 #define DEBUG_TIMESTAMP_TO_TM false
 
+/**
+ * On 8-bit AVR, 32-bit divisions compile to slow library calls. Set
+ * DCF77_FAST_TIME_ARITHMETIC to true, to convert time stamps within the
+ * years 2000..2099 with 16-bit intermediates and multiply-shift
+ * reciprocals instead. Time stamps outside that window fall back to
+ * the generic conversion.
+ */
+#ifndef DCF77_FAST_TIME_ARITHMETIC
+#if defined(ARDUINO_ARCH_AVR)
+#define DCF77_FAST_TIME_ARITHMETIC true
+#else
+#define DCF77_FAST_TIME_ARITHMETIC false
+#endif
+#endif
+
 namespace {
 
 #if DEBUG_TIMESTAMP_TO_TM
@@ -102,6 +117,119 @@ inline int yday(const DCF77tm& tm) {
   return yday_ + day;
 }
 
+#if DCF77_FAST_TIME_ARITHMETIC
+
+/* The years that can be represented by the 2 digit year of a dcf77 frame. */
+constexpr int FAST_YEAR_FIRST = 2000;
+constexpr int FAST_YEAR_LAST = 2099;
+/* Seconds since epoch at 1 Jan 2000 0:00:00 and 1 Jan 2100 0:00:00 */
+constexpr uint32_t FAST_EPOCH_FIRST = 946684800UL;
+constexpr uint32_t FAST_EPOCH_END = 4102444800UL;
+/* 1st January 2000 is a Saturday */
+constexpr uint8_t FAST_EPOCH_WDAY = 6;
+/* SECSPERDAY = 675 << 7 */
+constexpr uint16_t SECSPERDAY_SHR7 = 675;
+/* Within 2000..2099, every 4th year is a leap year. */
+constexpr uint16_t DAYS_PER_4_YEARS_2000 = DAYS_PER_4_YEARS;
+
+inline uint32_t mul16x16(const uint16_t a, const uint16_t b) {
+  return static_cast<uint32_t>(a) * b;
+}
+
+/**
+ * @return x % 7 by folding, since 512, 64 and 8 are congruent 1 modulo 7.
+ */
+inline uint8_t mod7(uint16_t x) {
+  x = (x >> 9) + (x & 0x1FF); /* [0, 638] */
+  x = (x >> 6) + (x & 0x3F);  /* [0, 72] */
+  x = (x >> 3) + (x & 0x7);   /* [0, 15] */
+  while (x >= DAYSPERWEEK) {
+    x -= DAYSPERWEEK;
+  }
+  return x;
+}
+
+/**
+ * toTimeStamp() for a tm structure with a year in 2000..2099.
+ */
+inline uint32_t toTimeStamp2000(const DCF77tm& tm) {
+  const uint8_t year = tm.year() - FAST_YEAR_FIRST;
+  const bool leapYear = (year & 3) == 0;
+  const uint16_t days = static_cast<uint16_t>(year) * DAYS_PER_YEAR + ((year + 3) >> 2)
+      + month_yday[leapYear][tm.tm_mon] + tm.tm_mday;
+  const int16_t minutes = tm.tm_hour * 60 + tm.tm_min;
+  return FAST_EPOCH_FIRST + (mul16x16(days, SECSPERDAY_SHR7) << 7)
+      + static_cast<int32_t>(minutes) * SECSPERMIN + tm.tm_sec;
+}
+
+/**
+ * set() for a time stamp within 2000..2099.
+ */
+inline void set2000(DCF77tm& tm, const uint32_t timestamp, const int isdst) {
+  const uint32_t secs = timestamp - FAST_EPOCH_FIRST;
+
+  /* Estimate days from the upper 16 bits: 49710 / 2**16 ~ 2**16 / SECSPERDAY.
+   * The estimate is at most 3 days too small. */
+  uint16_t days = mul16x16(secs >> 16, 49710) >> 16;
+  uint32_t remain = secs - (mul16x16(days, SECSPERDAY_SHR7) << 7);
+  while (remain >= static_cast<uint32_t>(SECSPERDAY)) {
+    remain -= SECSPERDAY;
+    ++days;
+  }
+
+  /* compute day of week */
+  tm.tm_wday = mod7(days + FAST_EPOCH_WDAY);
+
+  /* compute hour, min, and sec. SECSPERHOUR = 225 << 4 and
+   * 291 / 2**16 ~ 1 / 225. The estimate is at most 1 hour too small. */
+  uint8_t hour = mul16x16(remain >> 4, 291) >> 16;
+  uint16_t secOfHour = remain - mul16x16(hour, SECSPERHOUR);
+  if (secOfHour >= SECSPERHOUR) {
+    secOfHour -= SECSPERHOUR;
+    ++hour;
+  }
+  /* SECSPERMIN = 15 << 2 and 4370 / 2**16 ~ 1 / 15, exact for
+   * (secOfHour >> 2) < 900 */
+  const uint8_t min = mul16x16(secOfHour >> 2, 4370) >> 16;
+  tm.tm_hour = hour;
+  tm.tm_min = min;
+  tm.tm_sec = secOfHour - min * SECSPERMIN;
+
+  /* compute year, month and day. 2871 / 2**22 ~ 1 / 1461, may be
+   * one too big. */
+  uint8_t quad = mul16x16(days, 2871) >> 22;
+  /* The difference is within -1461..1460. It is computed modulo 2**16,
+   * where int has 16 bits, so wrap explicitly to obtain the same result
+   * with any width of int. */
+  int16_t quadday = static_cast<int16_t>(
+      static_cast<uint16_t>(days - quad * DAYS_PER_4_YEARS_2000));
+  if (quadday < 0) {
+    quadday += DAYS_PER_4_YEARS_2000;
+    --quad;
+  }
+  uint8_t yearInQuad = 0;
+  if (quadday >= DAYS_PER_YEAR + 1) {
+    quadday -= DAYS_PER_YEAR + 1;
+    yearInQuad = 1;
+    while (quadday >= DAYS_PER_YEAR) {
+      quadday -= DAYS_PER_YEAR;
+      ++yearInQuad;
+    }
+  }
+  const bool leapYear = yearInQuad == 0;
+  uint8_t month = 11;
+  while (quadday <= month_yday[leapYear][month]) {
+    --month;
+  }
+
+  tm.tm_mday = quadday - month_yday[leapYear][month];
+  tm.tm_mon = month;
+  tm.tm_year = FAST_YEAR_FIRST - DCF77tm::TM_YEAR_BASE + quad * 4 + yearInQuad;
+  tm.tm_isdst = isdst;
+}
+
+#endif
+
 } // anonymous namespace
 
 #if HAS_STD_CTIME
@@ -149,6 +277,25 @@ size_t DCF77tm::printTo(print_t& p) const {
 #endif
 
 DCF77time_t DCF77tm::toTimeStamp() const {
+#if DCF77_FAST_TIME_ARITHMETIC
+  if (year() >= FAST_YEAR_FIRST && year() <= FAST_YEAR_LAST) {
+    return toTimeStamp2000(*this);
+  }
+#endif
+  return toTimeStampGeneric();
+}
+
+void DCF77tm::set(const DCF77time_t timestamp, const int isdst) {
+#if DCF77_FAST_TIME_ARITHMETIC
+  if (timestamp >= FAST_EPOCH_FIRST && timestamp < FAST_EPOCH_END) {
+    set2000(*this, timestamp, isdst);
+    return;
+  }
+#endif
+  setGeneric(timestamp, isdst);
+}
+
+DCF77time_t DCF77tm::toTimeStampGeneric() const {
   using time_t = DCF77time_t;
   const bool leapYear = isLeapYear(year());
   const time_t leapYearsBeforeThisYear = leapYearsSince1970(year()) - leapYear;
@@ -157,7 +304,7 @@ DCF77time_t DCF77tm::toTimeStamp() const {
   return result;
 }
 
-void DCF77tm::set(const DCF77time_t timestamp, const int isdst)
+void DCF77tm::setGeneric(const DCF77time_t timestamp, const int isdst)
 {
   PRINT_VARIABLE(timestamp);
   long days = timestamp / SECSPERDAY + EPOCH_ADJUSTMENT_DAYS;
@@ -125,6 +125,14 @@ typedef Print print_t;
      *   Serial.println(tm);
      */
     size_t printTo(print_t& p) const override;
+
+  private:
+    /**
+     * Architecture independent implementations of toTimeStamp()
+     * and set().
+     */
+    DCF77time_t toTimeStampGeneric() const;
+    void setGeneric(const DCF77time_t timestamp, const int isdst);
   };
 
 